@@ -377,6 +377,37 @@ void VlRNG::set_randstate(const std::string& state) VL_MT_UNSAFE {
     }
 }
 
+VlRNGBulk::VlRNGBulk(uint64_t seed) VL_MT_SAFE {
+    // Seed lanes using SplitMix64, which never gives a lane an all-zero state
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        for (uint64_t* const statep : {&m_state0[lane], &m_state1[lane]}) {
+            seed += 0x9e3779b97f4a7c15ULL;
+            uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            *statep = z ^ (z >> 31);
+        }
+    }
+}
+void VlRNGBulk::fill(void* datap, size_t bytes) VL_MT_UNSAFE {
+    uint8_t* bytep = static_cast<uint8_t*>(datap);
+    uint64_t block[LANES];
+    while (bytes) {
+        // Xoroshiro128+ algorithm, as in VlRNG::rand64, on each lane
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            const uint64_t s0 = m_state0[lane];
+            const uint64_t s1 = m_state1[lane] ^ s0;
+            block[lane] = s0 + m_state1[lane];
+            m_state0[lane] = ((s0 << 55) | (s0 >> 9)) ^ s1 ^ (s1 << 14);
+            m_state1[lane] = (s1 << 36) | (s1 >> 28);
+        }
+        const size_t n = std::min(bytes, sizeof(block));
+        std::memcpy(bytep, block, n);
+        bytep += n;
+        bytes -= n;
+    }
+}
+
 static uint32_t vl_sys_rand32() VL_MT_SAFE {
     // Return random 32-bits using system library.
     // Used only to construct seed for Verilator's PRNG.
@@ -464,6 +495,61 @@ WDataOutP VL_SCOPED_RAND_RESET_W(int obits, WDataOutP outwp, uint64_t scopeHash,
     return outwp;
 }
 
+// Reset elements of storage type T, one random stream for the whole region
+template <typename T>
+static void vl_scoped_rand_reset_array(T* datap, size_t elements, T mask, uint64_t scopeHash,
+                                       uint64_t salt) VL_MT_UNSAFE {
+    const int randReset = Verilated::threadContextp()->randReset();
+    if (randReset == 0) {
+        std::fill_n(datap, elements, T{0});
+        return;
+    } else if (randReset == 1) {
+        std::fill_n(datap, elements, mask);
+        return;
+    }
+    VlRNGBulk rng{Verilated::threadContextp()->randSeed() ^ scopeHash ^ salt};
+    rng.fill(datap, elements * sizeof(T));
+    if (mask != static_cast<T>(~T{0})) {
+        for (size_t i = 0; i < elements; ++i) datap[i] &= mask;
+    }
+}
+
+void VL_SCOPED_RAND_RESET_ARRAY_I(int obits, CData* datap, size_t elements, uint64_t scopeHash,
+                                  uint64_t salt) VL_MT_UNSAFE {
+    vl_scoped_rand_reset_array(datap, elements, static_cast<CData>(VL_MASK_I(obits)), scopeHash,
+                               salt);
+}
+void VL_SCOPED_RAND_RESET_ARRAY_I(int obits, SData* datap, size_t elements, uint64_t scopeHash,
+                                  uint64_t salt) VL_MT_UNSAFE {
+    vl_scoped_rand_reset_array(datap, elements, static_cast<SData>(VL_MASK_I(obits)), scopeHash,
+                               salt);
+}
+void VL_SCOPED_RAND_RESET_ARRAY_I(int obits, IData* datap, size_t elements, uint64_t scopeHash,
+                                  uint64_t salt) VL_MT_UNSAFE {
+    vl_scoped_rand_reset_array(datap, elements, VL_MASK_I(obits), scopeHash, salt);
+}
+void VL_SCOPED_RAND_RESET_ARRAY_Q(int obits, QData* datap, size_t elements, uint64_t scopeHash,
+                                  uint64_t salt) VL_MT_UNSAFE {
+    vl_scoped_rand_reset_array(datap, elements, static_cast<QData>(VL_MASK_Q(obits)), scopeHash,
+                               salt);
+}
+void VL_SCOPED_RAND_RESET_ARRAY_W(int obits, EData* datap, size_t elements, uint64_t scopeHash,
+                                  uint64_t salt) VL_MT_UNSAFE {
+    const size_t words = VL_WORDS_I(obits);
+    const int randReset = Verilated::threadContextp()->randReset();
+    if (randReset == 2) {
+        VlRNGBulk rng{Verilated::threadContextp()->randSeed() ^ scopeHash ^ salt};
+        rng.fill(datap, elements * words * sizeof(EData));
+    } else {
+        std::fill_n(datap, elements * words, randReset == 0 ? EData{0} : ~EData{0});
+    }
+    // Only the last word of each element needs masking
+    const EData mask = VL_MASK_E(obits);
+    if (mask != ~EData{0}) {
+        for (size_t i = words - 1; i < elements * words; i += words) datap[i] &= mask;
+    }
+}
+
 IData VL_SCOPED_RAND_RESET_ASSIGN_I(int obits, uint64_t scopeHash, uint64_t salt) VL_MT_UNSAFE {
     VlRNG rng{Verilated::threadContextp()->randSeed() ^ scopeHash ^ salt};
     const IData data = rng.rand64() & VL_MASK_I(obits);
@@ -2643,6 +2729,7 @@ VerilatedContext::VerilatedContext()
 // Must declare here not in interface, as otherwise forward declarations not known
 VerilatedContext::~VerilatedContext() {
     checkMagic(this);
+    VerilatedContextImp::scopeGenerationInc();  // Invalidate any caches of our scopes
     m_magic = 0x1;  // Arbitrary but 0x1 is what Verilator src uses for a deleted pointer
 }
 
@@ -2789,6 +2876,18 @@ std::string VerilatedContext::solverProgram() const VL_MT_SAFE {
     const VerilatedLockGuard lock{m_mutex};
     return m_ns.m_solverProgram;
 }
+void VerilatedContext::solverFast(bool flag) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_ns.m_solverFast = flag;
+}
+void VerilatedContext::solverIncremental(bool flag) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_ns.m_solverIncremental = flag;
+}
+void VerilatedContext::solverProcs(uint32_t value) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_ns.m_solverProcs = value;
+}
 void VerilatedContext::quiet(bool flag) VL_MT_SAFE {
     const VerilatedLockGuard lock{m_mutex};
     m_s.m_quiet = flag;
@@ -3016,6 +3115,12 @@ void VerilatedContextImp::commandArgVl(const std::string& arg) {
         } else if (commandArgVlUint64(arg, "+verilator+seed+", u64, 1,
                                       std::numeric_limits<int>::max())) {
             randSeed(static_cast<int>(u64));
+        } else if (commandArgVlUint64(arg, "+verilator+solver+fast+", u64, 0, 1)) {
+            solverFast(u64 != 0);
+        } else if (commandArgVlUint64(arg, "+verilator+solver+incremental+", u64, 0, 1)) {
+            solverIncremental(u64 != 0);
+        } else if (commandArgVlUint64(arg, "+verilator+solver+procs+", u64, 1, 1024)) {
+            solverProcs(static_cast<uint32_t>(u64));
         } else if (arg == "+verilator+V") {
             VerilatedImp::versionDump();  // Someday more info too
             VL_FATAL_MT("COMMAND_LINE", 0, "",
@@ -3137,21 +3242,28 @@ void VerilatedContextImp::scopeInsert(const VerilatedScope* scopep) VL_MT_SAFE {
     // Slow ok - called once/scope at construction
     const VerilatedLockGuard lock{m_impdatap->m_nameMutex};
     const auto it = m_impdatap->m_nameMap.find(scopep->name());
-    if (it == m_impdatap->m_nameMap.end()) m_impdatap->m_nameMap.emplace(scopep->name(), scopep);
+    if (it == m_impdatap->m_nameMap.end()) {
+        m_impdatap->m_nameMap.emplace(scopep->name(), scopep);
+        m_impdatap->m_nameHash.emplace(scopep->name(), scopep);
+    }
 }
 void VerilatedContextImp::scopeErase(const VerilatedScope* scopep) VL_MT_SAFE {
     // Slow ok - called once/scope at destruction
     const VerilatedLockGuard lock{m_impdatap->m_nameMutex};
     VerilatedImp::userEraseScope(scopep);
     const auto it = m_impdatap->m_nameMap.find(scopep->name());
-    if (it != m_impdatap->m_nameMap.end()) m_impdatap->m_nameMap.erase(it);
+    if (it != m_impdatap->m_nameMap.end()) {
+        m_impdatap->m_nameMap.erase(it);
+        m_impdatap->m_nameHash.erase(scopep->name());
+    }
+    VerilatedContextImp::scopeGenerationInc();
 }
 const VerilatedScope* VerilatedContext::scopeFind(const char* namep) const VL_MT_SAFE {
     // Thread save only assuming this is called only after model construction completed
     const VerilatedLockGuard lock{m_impdatap->m_nameMutex};
     // If too slow, can assume this is only VL_MT_SAFE_POSINIT
-    const auto& it = m_impdatap->m_nameMap.find(namep);
-    if (VL_UNLIKELY(it == m_impdatap->m_nameMap.end())) return nullptr;
+    const auto& it = m_impdatap->m_nameHash.find(namep);
+    if (VL_UNLIKELY(it == m_impdatap->m_nameHash.end())) return nullptr;
     return it->second;
 }
 const VerilatedScopeNameMap* VerilatedContext::scopeNameMap() VL_MT_SAFE {
@@ -3546,6 +3658,11 @@ void VerilatedScope::varInsert(const char* namep, void* datap, bool isParam,
     m_varsp->emplace(namep, var);
 }
 
+void VerilatedScope::varDirtyInsert(const char* namep, uint8_t* dirtyp) VL_MT_UNSAFE {
+    // Must be called after varInsert of the same name
+    if (VerilatedVar* const varp = varFind(namep)) varp->m_dirtyp = dirtyp;
+}
+
 // cppcheck-suppress unusedFunction  // Used by applications
 VerilatedVar* VerilatedScope::varFind(const char* namep) const VL_MT_SAFE_POSTINIT {
     if (VL_LIKELY(m_varsp)) {
@@ -3626,6 +3743,95 @@ void VlDeleter::deleteAll() VL_EXCLUDES(m_mutex) VL_EXCLUDES(m_deleteMutex) VL_M
     }
 }
 
+//===========================================================================
+// VlDpiDeferred:: Methods
+
+class VlDpiDeferredWorker final {
+    // MEMBERS
+    VerilatedMutex m_mutex;  // Mutex protecting the flags
+    std::condition_variable_any m_cv;  // Signals a batch started, completed, or exit
+    bool m_busy VL_GUARDED_BY(m_mutex) = false;  // Batch handed over and not completed
+    bool m_exit VL_GUARDED_BY(m_mutex) = false;  // Thread should exit
+    std::vector<VlDpiDeferred::Call> m_calls;  // Batch, owned by the thread when m_busy
+    std::thread m_thread;  // Underlying thread
+
+    // METHODS
+    void main() VL_MT_SAFE_EXCLUDES(m_mutex) {
+        while (true) {
+            {
+                VerilatedLockGuard lock{m_mutex};
+                while (!m_busy && !m_exit) m_cv.wait(m_mutex);
+                if (!m_busy) return;
+            }
+            for (const VlDpiDeferred::Call& call : m_calls) call();
+            m_calls.clear();
+            {
+                const VerilatedLockGuard lock{m_mutex};
+                m_busy = false;
+            }
+            m_cv.notify_all();
+        }
+    }
+
+public:
+    // CONSTRUCTORS
+    VlDpiDeferredWorker()
+        : m_thread{[this] { main(); }} {}
+    ~VlDpiDeferredWorker() {
+        {
+            const VerilatedLockGuard lock{m_mutex};
+            m_exit = true;
+        }
+        m_cv.notify_all();
+        m_thread.join();
+    }
+    VL_UNCOPYABLE(VlDpiDeferredWorker);
+
+    // METHODS
+    void wait() VL_MT_SAFE_EXCLUDES(m_mutex) {
+        VerilatedLockGuard lock{m_mutex};
+        while (m_busy) m_cv.wait(m_mutex);
+    }
+    // Start a batch, returning the previous batch's emptied vector to reuse its storage
+    void start(std::vector<VlDpiDeferred::Call>& calls) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        wait();
+        {
+            const VerilatedLockGuard lock{m_mutex};
+            std::swap(m_calls, calls);
+            m_busy = true;
+        }
+        m_cv.notify_all();
+    }
+};
+
+VlDpiDeferred::VlDpiDeferred(bool async)
+    : m_workerp{async ? new VlDpiDeferredWorker : nullptr} {}
+
+VlDpiDeferred::~VlDpiDeferred() {
+    // The model's final() normally flushes the calls, but make any queued
+    // since rather than discarding them
+    flush();
+    delete m_workerp;
+}
+
+void VlDpiDeferred::dispatch() VL_MT_SAFE_EXCLUDES(m_mutex) {
+    {
+        const VerilatedLockGuard lock{m_mutex};
+        if (m_pending.empty()) return;
+        if (m_workerp) {
+            m_workerp->start(m_pending);
+            return;
+        }
+        std::swap(m_pending, m_running);
+    }
+    for (const Call& call : m_running) call();
+    m_running.clear();
+}
+
+void VlDpiDeferred::wait() VL_MT_SAFE {
+    if (m_workerp) m_workerp->wait();
+}
+
 //===========================================================================
 // OS functions (last, so we have minimal OS dependencies above)
 
@@ -409,6 +409,9 @@ protected:
         // Fast path
         uint64_t m_profExecStart = 1;  // +prof+exec+start time
         uint32_t m_profExecWindow = 2;  // +prof+exec+window size
+        uint32_t m_solverProcs = 1;  // +solver+procs setting
+        bool m_solverFast = true;  // +solver+fast setting
+        bool m_solverIncremental = true;  // +solver+incremental setting
         // Slow path
         std::string m_coverageFilename;  // +coverage+file filename
         std::string m_profExecFilename;  // +prof+exec+file filename
@@ -653,6 +656,15 @@ public:
     // Internal: SMT solver program
     std::string solverProgram() const VL_MT_SAFE;
     void solverProgram(const std::string& flag) VL_MT_SAFE;
+    // Internal: Solve common constraints without the SMT solver
+    bool solverFast() const VL_MT_SAFE { return m_ns.m_solverFast; }
+    void solverFast(bool flag) VL_MT_SAFE;
+    // Internal: Keep declarations and constraints in the SMT solver between calls
+    bool solverIncremental() const VL_MT_SAFE { return m_ns.m_solverIncremental; }
+    void solverIncremental(bool flag) VL_MT_SAFE;
+    // Internal: Number of SMT solver processes, shared by randomizing threads
+    uint32_t solverProcs() const VL_MT_SAFE { return m_ns.m_solverProcs; }
+    void solverProcs(uint32_t value) VL_MT_SAFE;
 
     // Internal: Find scope
     const VerilatedScope* scopeFind(const char* namep) const VL_MT_SAFE;
@@ -719,6 +731,7 @@ public:  // But internals only - called from verilated modules, VerilatedSyms
     void exportInsert(int finalize, const char* namep, void* cb) VL_MT_UNSAFE;
     void varInsert(const char* namep, void* datap, bool isParam, VerilatedVarType vltype,
                    int vlflags, int udims, int pdims, ...) VL_MT_UNSAFE;
+    void varDirtyInsert(const char* namep, uint8_t* dirtyp) VL_MT_UNSAFE;
     // ACCESSORS
     const char* name() const VL_MT_SAFE_POSTINIT { return m_namep; }
     const char* identifier() const VL_MT_SAFE_POSTINIT { return m_identifierp; }
@@ -28,6 +28,7 @@
 #include "verilated.h"
 #include "verilated_cov_key.h"
 
+#include <algorithm>
 #include <deque>
 #include <fstream>
 #include <map>
@@ -53,7 +54,8 @@ public:  // But only local to this file
     int m_keys[VerilatedCovConst::MAX_KEYS];  // Key
     int m_vals[VerilatedCovConst::MAX_KEYS];  // Value for specified key
     // CONSTRUCTORS
-    // Derived classes should call zero() in their constructor
+    // Items do not zero their count on construction, as may be built from a
+    // table after counting started; callers inserting new points call zero()
     VerilatedCovImpItem() {
         for (int i = 0; i < VerilatedCovConst::MAX_KEYS; ++i) {
             m_keys[i] = VerilatedCovConst::KEY_UNDEF;
@@ -84,12 +86,30 @@ public:
     // CONSTRUCTORS
     // cppcheck-suppress noExplicitConstructor
     explicit VerilatedCoverItemSpec(T* countp)
-        : m_countp{countp} {
-        *m_countp = 0;
-    }
+        : m_countp{countp} {}
     ~VerilatedCoverItemSpec() override = default;
 };
 
+//=============================================================================
+// VerilatedCoverItemBit
+// Coverage item that is a single bit of a --coverage-hit-only bitmap.
+
+class VerilatedCoverItemBit final : public VerilatedCovImpItem {
+private:
+    // MEMBERS
+    uint32_t* const m_wordp;  // Word holding the bit
+    const uint32_t m_mask;  // Mask of the bit within m_wordp
+public:
+    // METHODS
+    uint64_t count() const override { return (*m_wordp & m_mask) ? 1 : 0; }
+    void zero() const override { *m_wordp &= ~m_mask; }
+    // CONSTRUCTORS
+    VerilatedCoverItemBit(uint32_t* bitsp, int bit)
+        : m_wordp{bitsp + (bit >> 5)}
+        , m_mask{1U << (bit & 31)} {}
+    ~VerilatedCoverItemBit() override = default;
+};
+
 //=============================================================================
 // VerilatedCovImp
 //
@@ -104,6 +124,16 @@ private:
     using ValueIndexMap = std::map<const std::string, int>;
     using IndexValueMap = std::map<int, std::string>;
     using ItemList = std::deque<VerilatedCovImpItem*>;
+    struct Table final {  // Table of points inserted but not yet made into items
+        std::string m_hier;  // Instance hierarchy name
+        uint32_t* m_countsp;  // Counters, or hit bits
+        bool m_hitOnly;  // Counters are hit bits
+        bool m_enable;  // False if duplicate instance
+        const char* const* m_strsp;  // String pool
+        const VerilatedCovPointInfo* m_infop;  // Point information
+        size_t m_npoints;  // Number of elements in m_infop
+    };
+    using TableList = std::deque<Table>;
 
     // MEMBERS
     VerilatedContext* const m_contextp;  // Context VerilatedCovImp is pointed-to by
@@ -111,6 +141,8 @@ private:
     ValueIndexMap m_valueIndexes VL_GUARDED_BY(m_mutex);  // Unique arbitrary value for values
     IndexValueMap m_indexValues VL_GUARDED_BY(m_mutex);  // Unique arbitrary value for keys
     ItemList m_items VL_GUARDED_BY(m_mutex);  // List of all items
+    TableList m_tables VL_GUARDED_BY(m_mutex);  // Tables not yet made into m_items
+    uint32_t m_fakeZero = 0;  // Count for items of disabled (duplicate) tables
     int m_nextIndex VL_GUARDED_BY(m_mutex)
         = (VerilatedCovConst::KEY_UNDEF + 1);  // Next insert value
 
@@ -118,6 +150,11 @@ private:
     const char* m_insertFilenamep VL_GUARDED_BY(m_mutex) = nullptr;  // Filename about to insert
     int m_insertLineno VL_GUARDED_BY(m_mutex) = 0;  // Line number about to insert
     bool m_forcePerInstance VL_GUARDED_BY(m_mutex) = false;  // Force per_instance
+    uint64_t m_sampleCount = 0;  // sampleTick() calls so far
+    uint64_t m_sampleNext = 0;  // m_sampleCount at which to call m_sampleCb
+    uint64_t m_samplePeriod = 0;  // sampleTick() calls between m_sampleCb calls, 0=off
+    SampleCb m_sampleCb = nullptr;  // Sampling callback
+    void* m_sampleUserp = nullptr;  // Sampling callback user data
 
 public:
     // CONSTRUCTORS
@@ -248,11 +285,110 @@ private:
     void clearGuts() VL_REQUIRES(m_mutex) {
         for (const auto& itemp : m_items) VL_DO_DANGLING(delete itemp, itemp);
         m_items.clear();
+        m_tables.clear();
         m_indexValues.clear();
         m_valueIndexes.clear();
         m_nextIndex = VerilatedCovConst::KEY_UNDEF + 1;
     }
 
+    static int tableBins(const VerilatedCovPointInfo& info) VL_PURE {
+        if (info.m_type == VerilatedCovPointInfo::OTHER) return 1;
+        const int bits = (info.m_end >= info.m_begin) ? info.m_end - info.m_begin + 1
+                                                      : info.m_begin - info.m_end + 1;
+        return 2 * bits;
+    }
+    static void zeroTable(const Table& table) {
+        if (!table.m_enable) return;
+        for (size_t p = 0; p < table.m_npoints; ++p) {
+            const VerilatedCovPointInfo& info = table.m_infop[p];
+            for (uint32_t bin = info.m_bin; bin < info.m_bin + tableBins(info); ++bin) {
+                if (table.m_hitOnly) {
+                    table.m_countsp[bin >> 5] &= ~(1U << (bin & 31));
+                } else {
+                    table.m_countsp[bin] = 0;
+                }
+            }
+        }
+    }
+    void insertTableItem(const Table& table, uint32_t bin, const VerilatedCovPointInfo& info,
+                         const std::string& hier, const char* commentp)
+        VL_MT_SAFE_EXCLUDES(m_mutex) {
+        // As with _inserti, but without zeroing, as may already be counting
+        if (!table.m_enable) {
+            inserti(new VerilatedCoverItemSpec<uint32_t>{&m_fakeZero});
+        } else if (table.m_hitOnly) {
+            inserti(new VerilatedCoverItemBit{table.m_countsp, static_cast<int>(bin)});
+        } else {
+            inserti(new VerilatedCoverItemSpec<uint32_t>{table.m_countsp + bin});
+        }
+        const char* const filenamep = table.m_strsp[info.m_filename];
+        const char* const linescovp = table.m_strsp[info.m_linescov];
+        const std::string linestr = std::to_string(info.m_lineno);
+        const std::string columnstr = std::to_string(info.m_column);
+        insertf(filenamep, info.m_lineno);
+        _insertp("hier", hier.c_str(), "filename", filenamep, "lineno", linestr.c_str(),
+                 "column", columnstr.c_str(), "page", table.m_strsp[info.m_page], "comment",
+                 commentp, (linescovp[0] ? "linescov" : ""), linescovp);
+    }
+    void itemNameHier(const VerilatedCovImpItem* itemp, bool forcePerInstance, std::string& name,
+                      std::string& hier) VL_REQUIRES(m_mutex) {
+        // Set name to item's keys, and hier to hierarchy if may collapse hierarchies
+        bool per_instance = forcePerInstance;
+        for (int i = 0; i < VerilatedCovConst::MAX_KEYS; ++i) {
+            if (itemp->m_keys[i] != VerilatedCovConst::KEY_UNDEF) {
+                const std::string key = VerilatedCovKey::shortKey(m_indexValues[itemp->m_keys[i]]);
+                const std::string val = m_indexValues[itemp->m_vals[i]];
+                if (key == VL_CIK_PER_INSTANCE) {
+                    if (val != "0") per_instance = true;
+                }
+                if (key == VL_CIK_HIER) {
+                    hier = val;
+                } else {
+                    // Print it
+                    if (key == "page") {
+                        const std::string type = val.substr(2, val.find('/') - 2);
+                        name += keyValueFormatter(VL_CIK_TYPE, type);
+                    }
+                    name += keyValueFormatter(key, val);
+                }
+            }
+        }
+        if (per_instance) {  // Not collapsing hierarchies
+            name += keyValueFormatter(VL_CIK_HIER, hier);
+            hier = "";
+        }
+    }
+    void insertTables() VL_MT_SAFE_EXCLUDES(m_mutex) {
+        // Make items for all points in tables, in the order originally inserted
+        TableList tables;
+        {
+            const VerilatedLockGuard lock{m_mutex};
+            tables.swap(m_tables);
+        }
+        for (const Table& table : tables) {
+            for (size_t p = 0; p < table.m_npoints; ++p) {
+                const VerilatedCovPointInfo& info = table.m_infop[p];
+                std::string hier = table.m_hier + table.m_strsp[info.m_hier];
+                if (!hier.empty() && hier[0] == '.') hier = hier.substr(1);
+                const char* const commentp = table.m_strsp[info.m_comment];
+                if (info.m_type == VerilatedCovPointInfo::OTHER) {
+                    insertTableItem(table, info.m_bin, info, hier, commentp);
+                    continue;
+                }
+                uint32_t bin = info.m_bin;
+                const int step = (info.m_end >= info.m_begin) ? 1 : -1;
+                for (int i = info.m_begin; i != info.m_end + step; i += step) {
+                    std::string comment = commentp;
+                    if (info.m_type == VerilatedCovPointInfo::TOGGLE_RANGED) {
+                        comment += '[' + std::to_string(i) + ']';
+                    }
+                    insertTableItem(table, bin++, info, hier, (comment + ":1->0").c_str());
+                    insertTableItem(table, bin++, info, hier, (comment + ":0->1").c_str());
+                }
+            }
+        }
+    }
+
 public:
     // PUBLIC METHODS
     // cppcheck-suppress duplInheritedMember
@@ -272,6 +408,7 @@ public:
     // cppcheck-suppress duplInheritedMember
     void clearNonMatch(const char* const matchp) VL_MT_SAFE_EXCLUDES(m_mutex) {
         Verilated::quiesce();
+        insertTables();
         const VerilatedLockGuard lock{m_mutex};
         if (matchp && matchp[0]) {
             ItemList newlist;
@@ -290,8 +427,82 @@ public:
         Verilated::quiesce();
         const VerilatedLockGuard lock{m_mutex};
         for (const VerilatedCovImpItem* const itemp : m_items) itemp->zero();
+        for (const Table& table : m_tables) zeroTable(table);
+    }
+
+    // cppcheck-suppress duplInheritedMember
+    size_t points() VL_MT_SAFE_EXCLUDES(m_mutex) {
+        insertTables();
+        const VerilatedLockGuard lock{m_mutex};
+        return m_items.size();
+    }
+    // cppcheck-suppress duplInheritedMember
+    std::string pointName(size_t index) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        insertTables();
+        const VerilatedLockGuard lock{m_mutex};
+        if (VL_UNLIKELY(index >= m_items.size())) return "";
+        std::string name;
+        std::string hier;
+        itemNameHier(m_items[index], true, name, hier);
+        return name;
+    }
+    // cppcheck-suppress duplInheritedMember
+    void snapshot(std::vector<uint64_t>& snap) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        insertTables();
+        const VerilatedLockGuard lock{m_mutex};
+        snap.resize(m_items.size());
+        uint64_t* const snapp = snap.data();
+        size_t i = 0;
+        for (const VerilatedCovImpItem* const itemp : m_items) snapp[i++] = itemp->count();
+    }
+    // cppcheck-suppress duplInheritedMember
+    size_t snapshotDelta(const std::vector<uint64_t>& prev, std::vector<uint64_t>& snap,
+                         std::vector<uint64_t>& deltas) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        snapshot(snap);
+        const size_t size = snap.size();
+        // Points inserted after prev was taken have an implied previous count of zero
+        const size_t common = std::min(prev.size(), size);
+        deltas.resize(size);
+        // Simple loops over contiguous arrays, so the compiler can vectorize
+        const uint64_t* const prevp = prev.data();
+        const uint64_t* const snapp = snap.data();
+        uint64_t* const deltap = deltas.data();
+        size_t newHits = 0;
+        for (size_t i = 0; i < common; ++i) {
+            // A lower count than prev means zero() was called or a counter
+            // wrapped, so count from zero rather than underflow
+            deltap[i] = snapp[i] < prevp[i] ? snapp[i] : snapp[i] - prevp[i];
+            newHits += (prevp[i] == 0) & (snapp[i] != 0);
+        }
+        for (size_t i = common; i < size; ++i) {
+            deltap[i] = snapp[i];
+            newHits += snapp[i] != 0;
+        }
+        return newHits;
+    }
+    // cppcheck-suppress duplInheritedMember
+    void sampleCb(uint64_t period, SampleCb cb, void* userp) VL_MT_UNSAFE_ONE {
+        m_samplePeriod = cb ? period : 0;
+        m_sampleCb = cb;
+        m_sampleUserp = userp;
+        m_sampleNext = m_sampleCount + m_samplePeriod;
+    }
+    // cppcheck-suppress duplInheritedMember
+    void sampleTick() VL_MT_UNSAFE_ONE {
+        ++m_sampleCount;
+        if (VL_UNLIKELY(m_samplePeriod && m_sampleCount == m_sampleNext)) {
+            m_sampleNext += m_samplePeriod;
+            m_sampleCb(this, m_sampleCount, m_sampleUserp);
+        }
     }
 
+    void insertTable(const char* hierp, uint32_t* countsp, bool hitOnly, bool enable,
+                     const char* const* strsp, const VerilatedCovPointInfo* infop,
+                     size_t npoints) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        const VerilatedLockGuard lock{m_mutex};
+        m_tables.push_back(Table{hierp, countsp, hitOnly, enable, strsp, infop, npoints});
+        zeroTable(m_tables.back());
+    }
     // We assume there's always call to i/f/p in that order
     void inserti(VerilatedCovImpItem* itemp) VL_MT_SAFE_EXCLUDES(m_mutex) {
         const VerilatedLockGuard lock{m_mutex};
@@ -367,6 +578,7 @@ public:
     // cppcheck-suppress duplInheritedMember
     void write(const std::string& filename) VL_MT_SAFE_EXCLUDES(m_mutex) {
         Verilated::quiesce();
+        insertTables();
         const VerilatedLockGuard lock{m_mutex};
         selftest();
 
@@ -383,33 +595,7 @@ public:
         for (const auto& itemp : m_items) {
             std::string name;
             std::string hier;
-            bool per_instance = false;
-            if (m_forcePerInstance) per_instance = true;
-
-            for (int i = 0; i < VerilatedCovConst::MAX_KEYS; ++i) {
-                if (itemp->m_keys[i] != VerilatedCovConst::KEY_UNDEF) {
-                    const std::string key
-                        = VerilatedCovKey::shortKey(m_indexValues[itemp->m_keys[i]]);
-                    const std::string val = m_indexValues[itemp->m_vals[i]];
-                    if (key == VL_CIK_PER_INSTANCE) {
-                        if (val != "0") per_instance = true;
-                    }
-                    if (key == VL_CIK_HIER) {
-                        hier = val;
-                    } else {
-                        // Print it
-                        if (key == "page") {
-                            const std::string type = val.substr(2, val.find('/') - 2);
-                            name += keyValueFormatter(VL_CIK_TYPE, type);
-                        }
-                        name += keyValueFormatter(key, val);
-                    }
-                }
-            }
-            if (per_instance) {  // Not collapsing hierarchies
-                name += keyValueFormatter(VL_CIK_HIER, hier);
-                hier = "";
-            }
+            itemNameHier(itemp, m_forcePerInstance, name, hier);
 
             // Group versus point labels don't matter here, downstream
             // deals with it.  Seems bad for sizing though and doesn't
@@ -450,14 +636,45 @@ void VerilatedCovContext::clearNonMatch(const char* matchp) VL_MT_SAFE {
     impp()->clearNonMatch(matchp);
 }
 void VerilatedCovContext::zero() VL_MT_SAFE { impp()->zero(); }
+size_t VerilatedCovContext::points() VL_MT_SAFE { return impp()->points(); }
+std::string VerilatedCovContext::pointName(size_t index) VL_MT_SAFE {
+    return impp()->pointName(index);
+}
+void VerilatedCovContext::snapshot(std::vector<uint64_t>& snap) VL_MT_SAFE {
+    impp()->snapshot(snap);
+}
+size_t VerilatedCovContext::snapshotDelta(const std::vector<uint64_t>& prev,
+                                          std::vector<uint64_t>& snap,
+                                          std::vector<uint64_t>& deltas) VL_MT_SAFE {
+    return impp()->snapshotDelta(prev, snap, deltas);
+}
+void VerilatedCovContext::sampleCb(uint64_t period, SampleCb cb, void* userp) VL_MT_UNSAFE_ONE {
+    impp()->sampleCb(period, cb, userp);
+}
+void VerilatedCovContext::sampleTick() VL_MT_UNSAFE_ONE { impp()->sampleTick(); }
 void VerilatedCovContext::write(const std::string& filename) VL_MT_SAFE {
     impp()->write(filename);
 }
 void VerilatedCovContext::_inserti(uint32_t* itemp) VL_MT_SAFE {
-    impp()->inserti(new VerilatedCoverItemSpec<uint32_t>{itemp});
+    VerilatedCovImpItem* const newp = new VerilatedCoverItemSpec<uint32_t>{itemp};
+    newp->zero();
+    impp()->inserti(newp);
 }
 void VerilatedCovContext::_inserti(uint64_t* itemp) VL_MT_SAFE {
-    impp()->inserti(new VerilatedCoverItemSpec<uint64_t>{itemp});
+    VerilatedCovImpItem* const newp = new VerilatedCoverItemSpec<uint64_t>{itemp};
+    newp->zero();
+    impp()->inserti(newp);
+}
+void VerilatedCovContext::_insertb(uint32_t* bitsp, int bit) VL_MT_SAFE {
+    VerilatedCovImpItem* const newp = new VerilatedCoverItemBit{bitsp, bit};
+    newp->zero();
+    impp()->inserti(newp);
+}
+void VerilatedCovContext::_insertTable(const char* hierp, uint32_t* countsp, bool hitOnly,
+                                       bool enable, const char* const* strsp,
+                                       const VerilatedCovPointInfo* infop,
+                                       size_t npoints) VL_MT_SAFE {
+    impp()->insertTable(hierp, countsp, hitOnly, enable, strsp, infop, npoints);
 }
 void VerilatedCovContext::_insertf(const char* filename, int lineno) VL_MT_SAFE {
     impp()->insertf(filename, lineno);
@@ -32,6 +32,7 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 class VerilatedCovImp;
 
@@ -75,70 +76,183 @@ class VerilatedCovImp;
         ccontextp->_insertp("hier", name, __VA_ARGS__); \
     } while (false)
 
+//=============================================================================
+// Toggle coverage
+//
+// Each signal bit has two counters, 1->0 then 0->1.  The change mask is
+// computed a word at a time, and only the changed bits are then visited, so
+// the cost is proportional to the number of toggles rather than the width.
+
 static inline void VL_COV_TOGGLE_CHG_ST_I(const int width, uint32_t* covp, const IData newData,
                                           const IData oldData) {
-    const IData chgData = newData ^ oldData;
-    for (int i = 0; i < width; ++i) {
-        *(covp + 2 * i + ((newData >> i) & 1)) += (chgData >> i) & 1;
+    for (IData chgData = (newData ^ oldData) & VL_MASK_I(width); chgData; chgData &= chgData - 1) {
+        const int i = VL_LEASTSETBIT_I(chgData);
+        ++covp[2 * i + ((newData >> i) & 1)];
     }
 }
 
 static inline void VL_COV_TOGGLE_CHG_ST_Q(const int width, uint32_t* covp, const QData newData,
                                           const QData oldData) {
-    const QData chgData = newData ^ oldData;
-    for (int i = 0; i < width; ++i) {
-        *(covp + 2 * i + ((newData >> i) & 1)) += (chgData >> i) & 1;
+    for (QData chgData = (newData ^ oldData) & VL_MASK_Q(width); chgData; chgData &= chgData - 1) {
+        const int i = VL_LEASTSETBIT_Q(chgData);
+        ++covp[2 * i + ((newData >> i) & 1)];
     }
 }
 
 static inline void VL_COV_TOGGLE_CHG_ST_W(const int width, uint32_t* covp, WDataInP newData,
                                           WDataInP oldData) {
     for (int i = 0; i < VL_WORDS_I(width); ++i) {
-        const EData chgData = newData[i] ^ oldData[i];
-        if (chgData) {
-            for (int j = 0; j < width - i * VL_EDATASIZE; ++j) {
-                *(covp + (i * VL_EDATASIZE + j) * 2 + ((newData[i] >> j) & 1))
-                    += (chgData >> j) & 1;
-            }
+        uint32_t* const wcovp = covp + 2 * i * VL_EDATASIZE;
+        EData chgData = newData[i] ^ oldData[i];
+        if (i == VL_WORDS_I(width) - 1) chgData &= VL_MASK_E(width);
+        for (; chgData; chgData &= chgData - 1) {
+            const int j = VL_LEASTSETBIT_E(chgData);
+            ++wcovp[2 * j + ((newData[i] >> j) & 1)];
         }
     }
 }
 
 static inline void VL_COV_TOGGLE_CHG_MT_I(const int width, std::atomic<uint32_t>* covp,
                                           const IData newData, const IData oldData) VL_MT_SAFE {
-    const IData chgData = newData ^ oldData;
-    for (int i = 0; i < width; ++i) {
-        if (VL_BITISSET_I(chgData, i)) {
-            (covp + 2 * i + ((newData >> i) & 1))->fetch_add(1, std::memory_order_relaxed);
-        }
+    for (IData chgData = (newData ^ oldData) & VL_MASK_I(width); chgData; chgData &= chgData - 1) {
+        const int i = VL_LEASTSETBIT_I(chgData);
+        covp[2 * i + ((newData >> i) & 1)].fetch_add(1, std::memory_order_relaxed);
     }
 }
 
 static inline void VL_COV_TOGGLE_CHG_MT_Q(const int width, std::atomic<uint32_t>* covp,
                                           const QData newData, const QData oldData) VL_MT_SAFE {
-    const QData chgData = newData ^ oldData;
-    for (int i = 0; i < width; ++i) {
-        if (VL_BITISSET_Q(chgData, i)) {
-            (covp + 2 * i + ((newData >> i) & 1))->fetch_add(1, std::memory_order_relaxed);
-        }
+    for (QData chgData = (newData ^ oldData) & VL_MASK_Q(width); chgData; chgData &= chgData - 1) {
+        const int i = VL_LEASTSETBIT_Q(chgData);
+        covp[2 * i + ((newData >> i) & 1)].fetch_add(1, std::memory_order_relaxed);
     }
 }
 
 static inline void VL_COV_TOGGLE_CHG_MT_W(const int width, std::atomic<uint32_t>* covp,
                                           WDataInP newData, WDataInP oldData) VL_MT_SAFE {
     for (int i = 0; i < VL_WORDS_I(width); ++i) {
-        const EData chgData = newData[i] ^ oldData[i];
-        if (chgData) {
-            for (int j = 0; j < width - i * VL_EDATASIZE; ++j) {
-                if (VL_BITISSET_E(chgData, j)) {
-                    (covp + (i * VL_EDATASIZE + j) * 2 + ((newData[i] >> j) & 1))
-                        ->fetch_add(1, std::memory_order_relaxed);
-                }
-            }
+        std::atomic<uint32_t>* const wcovp = covp + 2 * i * VL_EDATASIZE;
+        EData chgData = newData[i] ^ oldData[i];
+        if (i == VL_WORDS_I(width) - 1) chgData &= VL_MASK_E(width);
+        for (; chgData; chgData &= chgData - 1) {
+            const int j = VL_LEASTSETBIT_E(chgData);
+            wcovp[2 * j + ((newData[i] >> j) & 1)].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+//=============================================================================
+// Hit-only coverage (--coverage-hit-only)
+//
+// Each coverage point is one bit in a packed bitmap of 32-bit words, rather
+// than a counter.  The bit is only stored on the first hit, so after warm-up
+// the check is an always-not-taken branch on a (mostly) cached line.
+
+static inline void VL_COV_HIT_ST(uint32_t* covp, const int bit) {
+    uint32_t& word = covp[bit >> 5];
+    const uint32_t mask = 1U << (bit & 31);
+    if (VL_UNLIKELY(!(word & mask))) word |= mask;
+}
+
+static inline void VL_COV_HIT_MT(std::atomic<uint32_t>* covp, const int bit) VL_MT_SAFE {
+    std::atomic<uint32_t>& word = covp[bit >> 5];
+    const uint32_t mask = 1U << (bit & 31);
+    if (VL_UNLIKELY(!(word.load(std::memory_order_relaxed) & mask))) {
+        word.fetch_or(mask, std::memory_order_relaxed);
+    }
+}
+
+// Toggle points are laid out as for counters, two per signal bit (1->0 then 0->1),
+// starting at bit "bit" of the bitmap.
+static inline void VL_COV_TOGGLE_HIT_ST_I(const int width, uint32_t* covp, const int bit,
+                                          const IData newData, const IData oldData) {
+    for (IData chgData = (newData ^ oldData) & VL_MASK_I(width); chgData; chgData &= chgData - 1) {
+        const int i = VL_LEASTSETBIT_I(chgData);
+        VL_COV_HIT_ST(covp, bit + 2 * i + ((newData >> i) & 1));
+    }
+}
+
+static inline void VL_COV_TOGGLE_HIT_ST_Q(const int width, uint32_t* covp, const int bit,
+                                          const QData newData, const QData oldData) {
+    for (QData chgData = (newData ^ oldData) & VL_MASK_Q(width); chgData; chgData &= chgData - 1) {
+        const int i = VL_LEASTSETBIT_Q(chgData);
+        VL_COV_HIT_ST(covp, bit + 2 * i + ((newData >> i) & 1));
+    }
+}
+
+static inline void VL_COV_TOGGLE_HIT_ST_W(const int width, uint32_t* covp, const int bit,
+                                          WDataInP newData, WDataInP oldData) {
+    for (int i = 0; i < VL_WORDS_I(width); ++i) {
+        const int wbit = bit + 2 * i * VL_EDATASIZE;
+        EData chgData = newData[i] ^ oldData[i];
+        if (i == VL_WORDS_I(width) - 1) chgData &= VL_MASK_E(width);
+        for (; chgData; chgData &= chgData - 1) {
+            const int j = VL_LEASTSETBIT_E(chgData);
+            VL_COV_HIT_ST(covp, wbit + 2 * j + ((newData[i] >> j) & 1));
+        }
+    }
+}
+
+static inline void VL_COV_TOGGLE_HIT_MT_I(const int width, std::atomic<uint32_t>* covp,
+                                          const int bit, const IData newData,
+                                          const IData oldData) VL_MT_SAFE {
+    for (IData chgData = (newData ^ oldData) & VL_MASK_I(width); chgData; chgData &= chgData - 1) {
+        const int i = VL_LEASTSETBIT_I(chgData);
+        VL_COV_HIT_MT(covp, bit + 2 * i + ((newData >> i) & 1));
+    }
+}
+
+static inline void VL_COV_TOGGLE_HIT_MT_Q(const int width, std::atomic<uint32_t>* covp,
+                                          const int bit, const QData newData,
+                                          const QData oldData) VL_MT_SAFE {
+    for (QData chgData = (newData ^ oldData) & VL_MASK_Q(width); chgData; chgData &= chgData - 1) {
+        const int i = VL_LEASTSETBIT_Q(chgData);
+        VL_COV_HIT_MT(covp, bit + 2 * i + ((newData >> i) & 1));
+    }
+}
+
+static inline void VL_COV_TOGGLE_HIT_MT_W(const int width, std::atomic<uint32_t>* covp,
+                                          const int bit, WDataInP newData,
+                                          WDataInP oldData) VL_MT_SAFE {
+    for (int i = 0; i < VL_WORDS_I(width); ++i) {
+        const int wbit = bit + 2 * i * VL_EDATASIZE;
+        EData chgData = newData[i] ^ oldData[i];
+        if (i == VL_WORDS_I(width) - 1) chgData &= VL_MASK_E(width);
+        for (; chgData; chgData &= chgData - 1) {
+            const int j = VL_LEASTSETBIT_E(chgData);
+            VL_COV_HIT_MT(covp, wbit + 2 * j + ((newData[i] >> j) & 1));
         }
     }
 }
 
+//=============================================================================
+// VerilatedCovPointInfo
+/// Static description of a Verilated coverage point, or for toggle coverage of
+/// the points for a range of signal bits.  Verilator emits these as constant
+/// tables, with strings as indices into a per-table string pool, so model
+/// construction does not need to build any coverage keys.
+
+struct VerilatedCovPointInfo final {
+    // TYPES
+    enum Type : uint8_t {
+        OTHER = 0,  // Single point, e.g. line or user coverage
+        TOGGLE = 1,  // Toggle points for bits m_begin..m_end
+        TOGGLE_RANGED = 2  // As TOGGLE, but comments have [bit] suffix
+    };
+    // MEMBERS
+    uint32_t m_bin;  // Index of (first) counter or hit bit in the model's coverage array
+    Type m_type;  // Type of point(s)
+    uint32_t m_filename;  // String index of filename
+    int m_lineno;  // Line number
+    int m_column;  // Column number
+    uint32_t m_hier;  // String index of hierarchy under the instance
+    uint32_t m_page;  // String index of page
+    uint32_t m_comment;  // String index of comment
+    uint32_t m_linescov;  // String index of lines covered, 0 if none
+    int m_begin;  // TOGGLE*: First bit
+    int m_end;  // TOGGLE*: Last bit, inclusive
+};
+
 //=============================================================================
 //  VerilatedCov
 /// Per-VerilatedContext coverage data class.
@@ -166,6 +280,29 @@ public:
     /// Zero coverage points
     void zero() VL_MT_SAFE;
 
+    // METHODS - Sampling windows
+    // Snapshots hold one count per coverage point, in a fixed point order
+    // that is valid until clear() or clearNonMatch() is called.
+    /// Return number of coverage points
+    size_t points() VL_MT_SAFE;
+    /// Return key name of the given coverage point, as would be written to the
+    /// coverage file with per-instance hierarchy
+    std::string pointName(size_t index) VL_MT_SAFE;
+    /// Copy current count of all coverage points into snapshot
+    void snapshot(std::vector<uint64_t>& snap) VL_MT_SAFE;
+    /// Take a snapshot, and set deltas to the counts gained since prev was
+    /// taken. Return number of points that were first hit since prev.
+    /// A point whose count is lower than in prev, due to zero() or the
+    /// counter wrapping, has a delta of its current count.
+    size_t snapshotDelta(const std::vector<uint64_t>& prev, std::vector<uint64_t>& snap,
+                         std::vector<uint64_t>& deltas) VL_MT_SAFE;
+    /// Callback for sampleCb; sample is the number of sampleTick() calls so far
+    using SampleCb = void (*)(VerilatedCovContext* covp, uint64_t sample, void* userp);
+    /// Call cb every period calls to sampleTick(), or disable if period is zero
+    void sampleCb(uint64_t period, SampleCb cb, void* userp) VL_MT_UNSAFE_ONE;
+    /// Advance one cycle for sampleCb, calling it if the period has elapsed
+    void sampleTick() VL_MT_UNSAFE_ONE;
+
     // METHODS - public but Internal use only
 
     // Insert a coverage item
@@ -175,6 +312,15 @@ public:
     // _insert1: Remember item pointer with count.  (Not const, as may add zeroing function)
     void _inserti(uint32_t* itemp) VL_MT_SAFE;
     void _inserti(uint64_t* itemp) VL_MT_SAFE;
+    // _insertb: As with _inserti, but item is a single bit of a hit-only bitmap
+    void _insertb(uint32_t* bitsp, int bit) VL_MT_SAFE;
+    // _insertTable: Insert all points described by a Verilator-emitted table,
+    // with counters (or hit bits if hitOnly) in countsp.  Only zeros the
+    // counters; keys are not built until needed, e.g. by write().
+    // If !enable, this is a duplicate instance, so insert items that read as zero.
+    void _insertTable(const char* hierp, uint32_t* countsp, bool hitOnly, bool enable,
+                      const char* const* strsp, const VerilatedCovPointInfo* infop,
+                      size_t npoints) VL_MT_SAFE;
     // _insert2: Set default filename and line number
     void _insertf(const char* filename, int lineno) VL_MT_SAFE;
     // _insert3: Set parameters
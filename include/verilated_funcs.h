@@ -112,6 +112,19 @@ extern QData VL_SCOPED_RAND_RESET_Q(int obits, uint64_t scopeHash, uint64_t salt
 extern WDataOutP VL_SCOPED_RAND_RESET_W(int obits, WDataOutP outwp, uint64_t scopeHash,
                                         uint64_t salt) VL_MT_UNSAFE;
 
+/// Random reset elements of an unpacked array of given element width, all
+/// dimensions flattened (init time only, var-specific PRNG)
+extern void VL_SCOPED_RAND_RESET_ARRAY_I(int obits, CData* datap, size_t elements,
+                                         uint64_t scopeHash, uint64_t salt) VL_MT_UNSAFE;
+extern void VL_SCOPED_RAND_RESET_ARRAY_I(int obits, SData* datap, size_t elements,
+                                         uint64_t scopeHash, uint64_t salt) VL_MT_UNSAFE;
+extern void VL_SCOPED_RAND_RESET_ARRAY_I(int obits, IData* datap, size_t elements,
+                                         uint64_t scopeHash, uint64_t salt) VL_MT_UNSAFE;
+extern void VL_SCOPED_RAND_RESET_ARRAY_Q(int obits, QData* datap, size_t elements,
+                                         uint64_t scopeHash, uint64_t salt) VL_MT_UNSAFE;
+extern void VL_SCOPED_RAND_RESET_ARRAY_W(int obits, EData* datap, size_t elements,
+                                         uint64_t scopeHash, uint64_t salt) VL_MT_UNSAFE;
+
 /// Random reset a signal of given width (assign time only)
 extern IData VL_SCOPED_RAND_RESET_ASSIGN_I(int obits, uint64_t scopeHash,
                                            uint64_t salt) VL_MT_UNSAFE;
@@ -864,6 +877,38 @@ static inline IData VL_MOSTSETBITP1_W(int words, WDataInP const lwp) VL_PURE {
     return 0;
 }
 
+// Index of least significant set bit; similar to CTZ.  Value must be non-zero
+static inline int VL_LEASTSETBIT_I(IData lhs) VL_PURE {
+#if defined(__GNUC__) && (__GNUC__ >= 4) && !defined(VL_NO_BUILTINS)
+    return __builtin_ctz(lhs);
+#else
+    int bit = 0;
+    for (; !(lhs & 1); lhs >>= 1) ++bit;
+    return bit;
+#endif
+}
+static inline int VL_LEASTSETBIT_Q(QData lhs) VL_PURE {
+#if defined(__GNUC__) && (__GNUC__ >= 4) && !defined(VL_NO_BUILTINS)
+    return __builtin_ctzll(lhs);
+#else
+    int bit = 0;
+    for (; !(lhs & 1); lhs >>= 1) ++bit;
+    return bit;
+#endif
+}
+#define VL_LEASTSETBIT_E VL_LEASTSETBIT_I
+
+// Index of most significant set bit; similar to FLS minus one.  Value must be non-zero
+static inline int VL_MOSTSETBIT_Q(QData lhs) VL_PURE {
+#if defined(__GNUC__) && (__GNUC__ >= 4) && !defined(VL_NO_BUILTINS)
+    return 63 - __builtin_clzll(lhs);
+#else
+    int bit = 0;
+    for (; lhs >>= 1;) ++bit;
+    return bit;
+#endif
+}
+
 //===================================================================
 // SIMPLE LOGICAL OPERATORS
 
@@ -207,6 +207,8 @@ protected:
     // Used by scopeInsert, scopeFind, scopeErase, scopeNameMap
     mutable VerilatedMutex m_nameMutex;  // Protect m_nameMap
     VerilatedScopeNameMap m_nameMap VL_GUARDED_BY(m_nameMutex);
+    // Hashed copy of m_nameMap, as scopeFind is called for each vpi_handle_by_name
+    VerilatedScopeHashMap m_nameHash VL_GUARDED_BY(m_nameMutex);
 };
 
 //======================================================================
@@ -225,6 +227,10 @@ class VerilatedContextImp final : VerilatedContext {
         VerilatedMutex s_randMutex;  // Mutex protecting s_randSeedEpoch
         // Number incrementing on each reseed, 0=illegal
         int s_randSeedEpoch = 1;  // Reads ok, wish had a VL_WRITE_GUARDED_BY(s_randMutex)
+        // Incremented when any context's scopes are erased or a context is destroyed, so
+        // caches of scope lookups may be invalidated.  Process-wide, so a new context at
+        // the address of a destroyed one still sees a new generation.
+        std::atomic<uint64_t> s_scopeGeneration{1};
     };
     static Statics& s() VL_MT_SAFE {
         static Statics s_s;
@@ -269,6 +275,8 @@ public:  // But only for verilated*.cpp
     // METHODS - scope name - INTERNAL only for verilated*.cpp
     void scopeInsert(const VerilatedScope* scopep) VL_MT_SAFE;
     void scopeErase(const VerilatedScope* scopep) VL_MT_SAFE;
+    static uint64_t scopeGeneration() VL_MT_SAFE { return s().s_scopeGeneration; }
+    static void scopeGenerationInc() VL_MT_SAFE { ++s().s_scopeGeneration; }
 
     // METHODS - file IO - INTERNAL only for verilated*.cpp
 
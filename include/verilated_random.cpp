@@ -22,8 +22,12 @@
 
 #include "verilated_random.h"
 
+#include <algorithm>
+#include <cctype>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <set>
 #include <sstream>
 #include <streambuf>
 
@@ -202,6 +206,9 @@ public:
         m_pidStatus = 0;
         m_readFd = fd_stdout[P_RD];
         m_writeFd = fd_stdin[P_WR];
+        // Not inherited by other solvers of the pool, so each sees end of file when closed
+        fcntl(m_readFd, F_SETFD, FD_CLOEXEC);
+        fcntl(m_writeFd, F_SETFD, FD_CLOEXEC);
 
         close(fd_stdin[P_RD]);
         close(fd_stdout[P_WR]);
@@ -213,31 +220,91 @@ public:
     }
 };
 
-static VlRProcess& getSolver() {
-    static VlRProcess s_solver;
-    static bool s_done = false;
-    if (s_done) return s_solver;
-    s_done = true;
+// State of the solver subprocess kept between randomizations.  Variables
+// stay declared, and constraints repeated from call to call stay asserted in
+// an outer (push) level, so each call sends only the constraints that changed.
+struct VlRSolverSession final {
+    bool m_started = false;  // Options and functions sent since last reset
+    bool m_outer = false;  // Outer level pushed
+    std::map<std::string, std::string> m_declared;  // Type of each declared variable
+    std::vector<std::string> m_asserted;  // Constraints asserted in the outer level
+    std::vector<std::string> m_previous;  // Constraints of the previous call
 
-    static std::vector<const char*> s_argv;
-    static std::string s_program = Verilated::threadContextp()->solverProgram();
-    s_argv.emplace_back(&s_program[0]);
-    for (char* arg = &s_program[0]; *arg; ++arg) {
+    void reset(std::ostream& os) {
+        if (m_started) os << "(reset)\n";
+        m_started = false;
+        m_outer = false;
+        m_declared.clear();
+        m_asserted.clear();
+        m_previous.clear();
+    }
+    void popOuter(std::ostream& os) {
+        if (!m_outer) return;
+        os << "(pop 1)\n";
+        m_outer = false;
+    }
+    void pushOuter(std::ostream& os) {
+        if (m_outer) return;
+        os << "(push 1)\n";
+        m_outer = true;
+        for (const std::string& constraint : m_asserted) {
+            os << "(assert (= #b1 " << constraint << "))\n";
+        }
+    }
+};
+
+// One solver subprocess of the pool
+struct VlRSolver final {
+    VerilatedMutex m_mutex;  // Held while a randomization uses this solver
+    bool m_opened = false;  // Subprocess started
+    std::string m_program;  // Command, split into m_argv
+    std::vector<const char*> m_argv;  // Subprocess arguments
+    VlRProcess m_process;  // Subprocess
+    VlRSolverSession m_session;  // State kept between randomizations
+};
+
+// Solver of the calling thread.  Each thread starts a new solver until the
+// pool has +verilator+solver+procs, then later threads share them in turn.
+static VlRSolver& getThreadSolver() {
+    static thread_local VlRSolver* t_solverp = nullptr;
+    if (VL_LIKELY(t_solverp)) return *t_solverp;
+    static VerilatedMutex s_mutex;
+    static std::vector<std::unique_ptr<VlRSolver>> s_solvers;
+    static size_t s_next = 0;
+    const VerilatedLockGuard lock{s_mutex};
+    if (s_solvers.size() < Verilated::threadContextp()->solverProcs()) {
+        s_solvers.emplace_back(new VlRSolver);
+        t_solverp = s_solvers.back().get();
+    } else {
+        t_solverp = s_solvers[s_next++ % s_solvers.size()].get();
+    }
+    return *t_solverp;
+}
+
+static VlRProcess& getSolver(VlRSolver& solver) {
+    VlRProcess& process = solver.m_process;
+    if (solver.m_opened) return process;
+    solver.m_opened = true;
+
+    solver.m_program = Verilated::threadContextp()->solverProgram();
+    std::vector<const char*>& argv = solver.m_argv;
+    argv.emplace_back(&solver.m_program[0]);
+    for (char* arg = &solver.m_program[0]; *arg; ++arg) {
         if (*arg == ' ') {
             *arg = '\0';
-            s_argv.emplace_back(arg + 1);
+            argv.emplace_back(arg + 1);
         }
     }
-    s_argv.emplace_back(nullptr);
+    argv.emplace_back(nullptr);
 
-    const char* const* const cmd = &s_argv[0];
-    s_solver.open(cmd);
-    s_solver << "(set-logic QF_ABV)\n";
-    s_solver << "(check-sat)\n";
-    s_solver << "(reset)\n";
+    const char* const* const cmd = &argv[0];
+    process.open(cmd);
+    process << "(set-logic QF_ABV)\n";
+    process << "(check-sat)\n";
+    process << "(reset)\n";
     std::string s;
-    getline(s_solver, s);
-    if (s == "sat") return s_solver;
+    getline(process, s);
+    if (s == "sat") return process;
 
     std::stringstream msg;
     msg << "Unable to communicate with SAT solver, please check its installation or specify a "
@@ -248,8 +315,8 @@ static VlRProcess& getSolver() {
     const std::string str = msg.str();
     VL_WARN_MT("", 0, "randomize", str.c_str());
 
-    while (getline(s_solver, s)) {}
-    return s_solver;
+    while (getline(process, s)) {}
+    return process;
 }
 
 static std::string readUntilBalanced(std::istream& stream) {
@@ -284,6 +351,1058 @@ static std::string parseNestedSelect(const std::string& nested_select_expr,
     return name;
 }
 
+// Uniform random value in [0, n), n of zero meaning 2^64
+static uint64_t randomBelow(VlRNG& rngr, uint64_t n) {
+    if (n == 0) return rngr.rand64();
+    const uint64_t threshold = (0 - n) % n;
+    while (true) {
+        const uint64_t r = rngr.rand64();
+        if (r >= threshold) return r % n;
+    }
+}
+
+//======================================================================
+// VlRandomTable:: Methods
+
+bool VlRandomTable::build(const std::vector<std::pair<uint64_t, uint64_t>>& ranges,
+                          const std::vector<double>& weights) {
+    // Vose's method, pairing each column below average weight with one above
+    double total = 0;
+    for (const double weight : weights) total += weight;
+    if (!(total > 0)) return false;
+    const size_t n = ranges.size();
+    m_ranges = ranges;
+    m_probs.resize(n);
+    m_aliases.resize(n);
+    std::vector<uint32_t> small;
+    std::vector<uint32_t> large;
+    for (uint32_t i = 0; i < n; ++i) {
+        m_probs[i] = weights[i] * n / total;
+        m_aliases[i] = i;
+        (m_probs[i] < 1.0 ? small : large).push_back(i);
+    }
+    while (!small.empty() && !large.empty()) {
+        const uint32_t smalli = small.back();
+        small.pop_back();
+        const uint32_t largei = large.back();
+        m_aliases[smalli] = largei;
+        m_probs[largei] -= 1.0 - m_probs[smalli];
+        if (m_probs[largei] < 1.0) {
+            large.pop_back();
+            small.push_back(largei);
+        }
+    }
+    // Left over from rounding
+    for (const uint32_t i : small) m_probs[i] = 1.0;
+    for (const uint32_t i : large) m_probs[i] = 1.0;
+    return true;
+}
+
+uint64_t VlRandomTable::sample(VlRNG& rngr) const {
+    // Column from upper half of random bits, coin from lower half
+    const uint64_t r = rngr.rand64();
+    uint64_t i = ((r >> 32) * m_ranges.size()) >> 32;
+    if (static_cast<double>(r & 0xffffffffULL) * (1.0 / 4294967296.0) >= m_probs[i]) {
+        i = m_aliases[i];
+    }
+    const std::pair<uint64_t, uint64_t>& range = m_ranges[i];
+    if (range.first == range.second) return range.first;
+    return range.first + randomBelow(rngr, range.second - range.first + 1);
+}
+
+//======================================================================
+// VlRandomFastSolver: In-process solving of common constraints
+//
+// Constraints are parsed from the same SMT-LIB text sent to the external
+// solver, but only a subset of the bit-vector logic over variables of up to
+// 64 bits is understood.  Constraints comparing a single variable against
+// constants (ranges, inside, dist, equality) give each variable a domain of
+// intervals.  Equalities defining a variable from others are computed
+// directly.  Remaining constraints are checked as soon as their variables
+// are chosen, backtracking on failure.  If the constraints fall outside the
+// subset, the caller uses the external solver instead.
+//
+// Variables sharing no constraint are solved as independent groups, so a
+// group of only single-variable constraints is sampled directly from its
+// domains.  A group with no solution found quickly is left to the external
+// solver, as a smaller problem without the other groups.
+//
+// A variable given dist weights is chosen by weight, using a VlRandomTable.
+// A group of one constraint on one variable, e.g. a dist or large inside
+// set, keeps its table between calls, found by the constraint's text, so
+// later calls sample it in O(1) time without parsing the constraint.  Each
+// call still builds this solver's state of every variable, and hashes the
+// constraint text to find the table; the text is rebuilt by every call, as
+// it holds the values of non-random variables.
+
+class VlRandomFastSolver final {
+public:
+    enum class Result : uint8_t { SAT, UNSAT, UNKNOWN };
+
+private:
+    // TYPES
+    enum Op : uint8_t {
+        OP_CONST,
+        OP_VAR,
+        OP_ADD,
+        OP_AND,
+        OP_ASHR,
+        OP_BOOL_AND,
+        OP_BOOL_OR,
+        OP_CONCAT,
+        OP_DISTINCT,
+        OP_EQ,
+        OP_EXTRACT,
+        OP_IMPLIES,
+        OP_ITE,
+        OP_LSHR,
+        OP_MUL,
+        OP_NEG,
+        OP_NOT,
+        OP_BVNOT,
+        OP_OR,
+        OP_REPEAT,
+        OP_SDIV,
+        OP_SEXT,
+        OP_SGE,
+        OP_SGT,
+        OP_SHL,
+        OP_SLE,
+        OP_SLT,
+        OP_SMOD,
+        OP_SUB,
+        OP_UDIV,
+        OP_UGE,
+        OP_UGT,
+        OP_ULE,
+        OP_ULT,
+        OP_UREM,
+        OP_XNOR,
+        OP_XOR,
+        OP_ZEXT
+    };
+    struct Node final {
+        Op m_op;
+        int m_width;  // Result width, 1 for booleans
+        uint32_t m_param;  // Variable index, or extract LSB
+        uint64_t m_value;  // Constant value
+        uint32_t m_argsStart;  // First argument in m_args
+        uint32_t m_nargs;  // Number of arguments
+    };
+    // Sorted, disjoint inclusive ranges of unsigned values
+    using Intervals = std::vector<std::pair<uint64_t, uint64_t>>;
+    struct Var final {
+        const VlRandomVar* m_varp;  // Variable
+        const std::string* m_namep;  // Solver name
+        uint64_t m_mask;  // Mask of width
+        Intervals m_domain;  // Possible values
+        bool m_randomize = false;  // Else constant, rand_mode off
+        int m_pos = -1;  // Position in search order, -1 if constant
+        int m_defNode = -1;  // Node computing value, or -1 if chosen randomly
+        int m_defCheck = -1;  // Constraint making m_defNode, to check if it is dropped
+        const VlRandomDist* m_distp = nullptr;  // First dist item of variable, if any
+        size_t m_ndists = 0;  // Number of dist items
+        const VlRandomTable* m_tablep = nullptr;  // Table choosing values, if any
+    };
+    struct Token final {
+        const char* m_startp;
+        size_t m_len;
+    };
+
+    // MEMBERS
+    std::vector<Var> m_vars;  // Variables, in VlRandomizer order
+    std::map<std::string, uint32_t> m_varIndex;  // Index of each variable name
+    std::vector<Node> m_nodes;  // Expression nodes
+    std::vector<uint32_t> m_args;  // Expression node arguments
+    std::vector<uint64_t> m_values;  // Current value of each variable
+    std::vector<uint32_t> m_solved;  // Variables solved in-process, to write
+    std::vector<uint32_t> m_external;  // Constraints of groups for the external solver
+    std::set<std::string> m_externalVars;  // Variables of groups for the external solver
+    const std::vector<VlRandomDist>& m_dists;  // Weights of dist constraints
+    std::unordered_map<std::string, VlRandomTable>& m_tables;  // Tables kept between calls
+    const char* m_curp = nullptr;  // Parse position
+    bool m_ok = true;  // Constraints are in the supported subset
+
+    // Limits of the search
+    static constexpr uint32_t MAX_TRIES = 32;  // Random choices of a variable before backtracking
+    static constexpr uint32_t MAX_STEPS = 4096;  // Failed choices before using external solver
+    static constexpr size_t MAX_TABLES = 256;  // Tables kept between calls
+    static constexpr uint32_t NOT_PARSED = ~0U;  // Root of constraint not yet parsed
+
+    // METHODS - values
+    static uint64_t mask(int width) { return width >= 64 ? ~0ULL : ((1ULL << width) - 1); }
+    static int64_t toSigned(uint64_t value, int width) {
+        if (width >= 64) return static_cast<int64_t>(value);
+        const uint64_t signBit = 1ULL << (width - 1);
+        return static_cast<int64_t>((value ^ signBit) - signBit);
+    }
+    static uint64_t readVar(const VlRandomVar& var) {
+        const void* const datap = var.datap(0);
+        if (var.width() <= VL_BYTESIZE) return *static_cast<const CData*>(datap);
+        if (var.width() <= VL_SHORTSIZE) return *static_cast<const SData*>(datap);
+        if (var.width() <= VL_IDATASIZE) return *static_cast<const IData*>(datap);
+        return *static_cast<const QData*>(datap);
+    }
+    static void writeVar(const VlRandomVar& var, uint64_t value) {
+        void* const datap = var.datap(0);
+        if (var.width() <= VL_BYTESIZE) {
+            *static_cast<CData*>(datap) = static_cast<CData>(value);
+        } else if (var.width() <= VL_SHORTSIZE) {
+            *static_cast<SData*>(datap) = static_cast<SData>(value);
+        } else if (var.width() <= VL_IDATASIZE) {
+            *static_cast<IData*>(datap) = static_cast<IData>(value);
+        } else {
+            *static_cast<QData*>(datap) = value;
+        }
+    }
+
+    // METHODS - intervals
+    static Intervals intersect(const Intervals& a, const Intervals& b) {
+        Intervals result;
+        size_t i = 0;
+        size_t j = 0;
+        while (i < a.size() && j < b.size()) {
+            const uint64_t lo = std::max(a[i].first, b[j].first);
+            const uint64_t hi = std::min(a[i].second, b[j].second);
+            if (lo <= hi) result.emplace_back(lo, hi);
+            if (a[i].second < b[j].second) {
+                ++i;
+            } else {
+                ++j;
+            }
+        }
+        return result;
+    }
+    static Intervals unite(const Intervals& a, const Intervals& b) {
+        Intervals all;
+        std::merge(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(all));
+        Intervals result;
+        for (const auto& range : all) {
+            if (!result.empty()
+                && (result.back().second == ~0ULL || range.first <= result.back().second + 1)) {
+                result.back().second = std::max(result.back().second, range.second);
+            } else {
+                result.push_back(range);
+            }
+        }
+        return result;
+    }
+    static Intervals complement(const Intervals& a, uint64_t maxValue) {
+        Intervals result;
+        uint64_t next = 0;
+        bool done = false;
+        for (const auto& range : a) {
+            if (range.first > next) result.emplace_back(next, range.first - 1);
+            if (range.second == maxValue) {
+                done = true;
+                break;
+            }
+            next = range.second + 1;
+        }
+        if (!done) result.emplace_back(next, maxValue);
+        return result;
+    }
+    static bool contains(const Intervals& a, uint64_t value) {
+        for (const auto& range : a) {
+            if (value < range.first) return false;
+            if (value <= range.second) return true;
+        }
+        return false;
+    }
+    // Values of 'width' bits for which '<var> <op> <value>' holds
+    static Intervals compareIntervals(Op op, uint64_t value, int width) {
+        const uint64_t maxValue = mask(width);
+        // Signed comparisons are unsigned ones with the sign bit inverted
+        const bool isSigned = op == OP_SLT || op == OP_SLE || op == OP_SGT || op == OP_SGE;
+        const uint64_t signBit = isSigned ? (1ULL << (width - 1)) : 0;
+        value ^= signBit;
+        uint64_t lo = 0;
+        uint64_t hi = maxValue;
+        switch (op) {
+        case OP_ULT:
+        case OP_SLT:
+            if (value == 0) return {};
+            hi = value - 1;
+            break;
+        case OP_ULE:
+        case OP_SLE: hi = value; break;
+        case OP_UGT:
+        case OP_SGT:
+            if (value == maxValue) return {};
+            lo = value + 1;
+            break;
+        case OP_UGE:
+        case OP_SGE: lo = value; break;
+        default: return {{value, value}};  // OP_EQ
+        }
+        if (!signBit) return {{lo, hi}};
+        // Map back from inverted sign bit
+        if ((lo & signBit) == (hi & signBit)) return {{lo ^ signBit, hi ^ signBit}};
+        return unite({{lo ^ signBit, maxValue}}, {{0, hi ^ signBit}});
+    }
+    static bool isCompare(Op op) {
+        return op == OP_ULT || op == OP_ULE || op == OP_UGT || op == OP_UGE || op == OP_SLT
+               || op == OP_SLE || op == OP_SGT || op == OP_SGE;
+    }
+    // Result is 1-bit regardless of operand widths
+    static bool isBoolean(Op op) {
+        return isCompare(op) || op == OP_EQ || op == OP_DISTINCT || op == OP_IMPLIES
+               || op == OP_BOOL_AND || op == OP_BOOL_OR;
+    }
+    // Exactly two operands; other operators with several are folded left
+    static bool isBinary(Op op) {
+        return isCompare(op) || op == OP_IMPLIES || op == OP_ASHR || op == OP_LSHR
+               || op == OP_SHL || op == OP_SDIV || op == OP_SMOD || op == OP_SUB
+               || op == OP_UDIV || op == OP_UREM;
+    }
+    static Op swapCompare(Op op) {
+        switch (op) {
+        case OP_ULT: return OP_UGT;
+        case OP_ULE: return OP_UGE;
+        case OP_UGT: return OP_ULT;
+        case OP_UGE: return OP_ULE;
+        case OP_SLT: return OP_SGT;
+        case OP_SLE: return OP_SGE;
+        case OP_SGT: return OP_SLT;
+        case OP_SGE: return OP_SLE;
+        default: return op;
+        }
+    }
+
+    // METHODS - parsing
+    Token token() {
+        while (*m_curp == ' ' || *m_curp == '\t' || *m_curp == '\n') ++m_curp;
+        const char* const startp = m_curp;
+        if (*m_curp == '(' || *m_curp == ')') {
+            ++m_curp;
+        } else {
+            while (*m_curp && *m_curp != ' ' && *m_curp != '\t' && *m_curp != '\n'
+                   && *m_curp != '(' && *m_curp != ')')
+                ++m_curp;
+        }
+        return Token{startp, static_cast<size_t>(m_curp - startp)};
+    }
+    static bool is(const Token& tok, const char* textp) {
+        return tok.m_len == std::strlen(textp)
+               && 0 == std::strncmp(tok.m_startp, textp, tok.m_len);
+    }
+    bool expect(const char* textp) {
+        if (!is(token(), textp)) m_ok = false;
+        return m_ok;
+    }
+    uint32_t number() {
+        const Token tok = token();
+        uint32_t result = 0;
+        for (size_t i = 0; i < tok.m_len; ++i) {
+            if (!std::isdigit(tok.m_startp[i]) || result > 1000000) {
+                m_ok = false;
+                return 0;
+            }
+            result = result * 10 + (tok.m_startp[i] - '0');
+        }
+        return result;
+    }
+    uint32_t newNode(Op op, int width, const std::vector<uint32_t>& args, uint32_t param = 0,
+                     uint64_t value = 0) {
+        if (width < 1 || width > 64) m_ok = false;
+        m_nodes.push_back(Node{op, width, param, value, static_cast<uint32_t>(m_args.size()),
+                               static_cast<uint32_t>(args.size())});
+        m_args.insert(m_args.end(), args.begin(), args.end());
+        return static_cast<uint32_t>(m_nodes.size() - 1);
+    }
+    const Node& arg(const Node& node, uint32_t i) const {
+        return m_nodes[m_args[node.m_argsStart + i]];
+    }
+    uint32_t parseAtom(const Token& tok) {
+        if (tok.m_len > 2 && tok.m_startp[0] == '#') {
+            const int digitBits = tok.m_startp[1] == 'b' ? 1 : tok.m_startp[1] == 'x' ? 4 : 0;
+            const size_t ndigits = tok.m_len - 2;
+            if (!digitBits || ndigits * digitBits > 64) {
+                m_ok = false;
+                return 0;
+            }
+            uint64_t value = 0;
+            for (size_t i = 2; i < tok.m_len; ++i) {
+                const char c = std::tolower(tok.m_startp[i]);
+                const int digit = std::isdigit(c) ? c - '0' : c - 'a' + 10;
+                if (digit < 0 || digit >= (1 << digitBits)) m_ok = false;
+                value = (value << digitBits) | (digit & 15);
+            }
+            return newNode(OP_CONST, static_cast<int>(ndigits * digitBits), {}, 0, value);
+        }
+        const auto it = m_varIndex.find(std::string{tok.m_startp, tok.m_len});
+        if (it == m_varIndex.end()) {
+            m_ok = false;  // E.g. array select
+            return 0;
+        }
+        return newNode(OP_VAR, m_vars[it->second].m_varp->width(), {}, it->second);
+    }
+    uint32_t parseExpr() {
+        const Token tok = token();
+        if (!m_ok || tok.m_len == 0) {
+            m_ok = false;
+            return 0;
+        }
+        if (!is(tok, "(")) return parseAtom(tok);
+        const Token opTok = token();
+        if (is(opTok, "(")) {
+            // Indexed operator, e.g. ((_ extract 7 0) x)
+            if (!expect("_")) return 0;
+            const Token nameTok = token();
+            const uint32_t param1 = number();
+            const uint32_t param2 = is(nameTok, "extract") ? number() : 0;
+            if (!expect(")")) return 0;
+            const uint32_t argi = parseExpr();
+            if (!expect(")")) return 0;
+            const int width = m_nodes[argi].m_width;
+            if (is(nameTok, "extract")) {
+                if (param1 < param2 || static_cast<int>(param1) >= width) m_ok = false;
+                return newNode(OP_EXTRACT, param1 - param2 + 1, {argi}, param2);
+            }
+            if (is(nameTok, "zero_extend")) return newNode(OP_ZEXT, width + param1, {argi});
+            if (is(nameTok, "sign_extend")) return newNode(OP_SEXT, width + param1, {argi});
+            if (is(nameTok, "repeat")) return newNode(OP_REPEAT, width * param1, {argi});
+            m_ok = false;
+            return 0;
+        }
+        std::vector<uint32_t> args;
+        while (m_ok) {
+            while (*m_curp == ' ' || *m_curp == '\t' || *m_curp == '\n') ++m_curp;
+            if (*m_curp == ')') break;
+            if (!*m_curp) m_ok = false;
+            args.push_back(parseExpr());
+        }
+        if (!expect(")") || args.empty()) {
+            m_ok = false;
+            return 0;
+        }
+        // Boolean conversions are identities, as booleans are 1-bit values
+        if (is(opTok, "__Vbv") || is(opTok, "__Vbool")) {
+            if (args.size() != 1 || m_nodes[args[0]].m_width != 1) m_ok = false;
+            return args[0];
+        }
+        static const std::map<std::string, Op> s_ops{
+            {"=", OP_EQ},           {"=>", OP_IMPLIES},         {"and", OP_BOOL_AND},
+            {"bvadd", OP_ADD},      {"bvand", OP_AND},          {"bvashr", OP_ASHR},
+            {"bvlshr", OP_LSHR},    {"bvmul", OP_MUL},          {"bvneg", OP_NEG},
+            {"bvnot", OP_BVNOT},    {"bvor", OP_OR},            {"bvsdiv", OP_SDIV},
+            {"bvsge", OP_SGE},      {"bvsgt", OP_SGT},          {"bvshl", OP_SHL},
+            {"bvsle", OP_SLE},      {"bvslt", OP_SLT},          {"bvsmod", OP_SMOD},
+            {"bvsub", OP_SUB},      {"bvudiv", OP_UDIV},        {"bvuge", OP_UGE},
+            {"bvugt", OP_UGT},      {"bvule", OP_ULE},          {"bvult", OP_ULT},
+            {"bvurem", OP_UREM},    {"bvxnor", OP_XNOR},        {"bvxor", OP_XOR},
+            {"concat", OP_CONCAT},  {"distinct", OP_DISTINCT},  {"ite", OP_ITE},
+            {"not", OP_NOT},        {"or", OP_BOOL_OR}};
+        const auto it = s_ops.find(std::string{opTok.m_startp, opTok.m_len});
+        if (it == s_ops.end()) {
+            m_ok = false;  // E.g. select
+            return 0;
+        }
+        const Op op = it->second;
+        const int width0 = m_nodes[args[0]].m_width;
+        int width = width0;
+        switch (op) {
+        case OP_NOT:
+        case OP_NEG:
+        case OP_BVNOT:
+            if (args.size() != 1) m_ok = false;
+            break;
+        case OP_ITE:
+            if (args.size() != 3 || width0 != 1
+                || m_nodes[args[1]].m_width != m_nodes[args[2]].m_width)
+                m_ok = false;
+            width = m_nodes[args[1]].m_width;
+            break;
+        case OP_CONCAT:
+            width = 0;
+            for (const uint32_t argi : args) width += m_nodes[argi].m_width;
+            break;
+        default:
+            // Operands of equal widths
+            for (const uint32_t argi : args) {
+                if (m_nodes[argi].m_width != width0) m_ok = false;
+            }
+            if (isBoolean(op)) width = 1;
+            if (isBinary(op) && args.size() != 2) m_ok = false;
+            break;
+        }
+        if (!m_ok) return 0;
+        if (width == 1 && (op == OP_AND || op == OP_OR || op == OP_BOOL_AND || op == OP_BOOL_OR)) {
+            // Drop constant terms, e.g. of dist weights
+            const bool isAnd = op == OP_AND || op == OP_BOOL_AND;
+            std::vector<uint32_t> terms;
+            for (const uint32_t argi : args) {
+                const Node& argNode = m_nodes[argi];
+                if (argNode.m_op != OP_CONST) {
+                    terms.push_back(argi);
+                } else if ((argNode.m_value != 0) != isAnd) {
+                    return argi;  // Decides result, e.g. 'and' with false
+                }
+            }
+            if (terms.empty()) return newNode(OP_CONST, 1, {}, 0, isAnd);
+            if (terms.size() == 1) return terms[0];
+            args = terms;
+        }
+        const uint32_t nodei = newNode(op, width, args);
+        bool allConst = true;
+        for (const uint32_t argi : args) allConst &= m_nodes[argi].m_op == OP_CONST;
+        if (allConst) m_nodes[nodei] = Node{OP_CONST, width, 0, eval(nodei), 0, 0};
+        return nodei;
+    }
+
+    // METHODS - evaluation
+    uint64_t eval(uint32_t nodei) const {
+        const Node& node = m_nodes[nodei];
+        const uint32_t* const argsp = m_args.data() + node.m_argsStart;
+        const uint64_t resultMask = mask(node.m_width);
+        switch (node.m_op) {
+        case OP_CONST: return node.m_value;
+        case OP_VAR: return m_values[node.m_param];
+        case OP_ITE: return eval(argsp[0]) ? eval(argsp[1]) : eval(argsp[2]);
+        case OP_NOT: return !eval(argsp[0]);
+        case OP_BVNOT: return ~eval(argsp[0]) & resultMask;
+        case OP_NEG: return (0 - eval(argsp[0])) & resultMask;
+        case OP_EXTRACT: return (eval(argsp[0]) >> node.m_param) & resultMask;
+        case OP_ZEXT: return eval(argsp[0]);
+        case OP_SEXT: {
+            const int width = m_nodes[argsp[0]].m_width;
+            return static_cast<uint64_t>(toSigned(eval(argsp[0]), width)) & resultMask;
+        }
+        case OP_REPEAT: {
+            const int width = m_nodes[argsp[0]].m_width;
+            const uint64_t value = eval(argsp[0]);
+            uint64_t result = 0;
+            for (int lsb = 0; lsb < node.m_width; lsb += width) result |= value << lsb;
+            return result;
+        }
+        case OP_CONCAT: {
+            uint64_t result = 0;
+            for (uint32_t i = 0; i < node.m_nargs; ++i) {
+                const int width = m_nodes[argsp[i]].m_width;
+                result = (width >= 64 ? 0 : (result << width)) | eval(argsp[i]);
+            }
+            return result;
+        }
+        case OP_DISTINCT:
+            for (uint32_t i = 0; i < node.m_nargs; ++i) {
+                for (uint32_t j = i + 1; j < node.m_nargs; ++j) {
+                    if (eval(argsp[i]) == eval(argsp[j])) return 0;
+                }
+            }
+            return 1;
+        case OP_EQ: {
+            const uint64_t value = eval(argsp[0]);
+            for (uint32_t i = 1; i < node.m_nargs; ++i) {
+                if (eval(argsp[i]) != value) return 0;
+            }
+            return 1;
+        }
+        case OP_BOOL_AND:
+            for (uint32_t i = 0; i < node.m_nargs; ++i) {
+                if (!eval(argsp[i])) return 0;
+            }
+            return 1;
+        case OP_BOOL_OR:
+            for (uint32_t i = 0; i < node.m_nargs; ++i) {
+                if (eval(argsp[i])) return 1;
+            }
+            return 0;
+        case OP_IMPLIES: return !eval(argsp[0]) || eval(argsp[1]);
+        case OP_AND:
+        case OP_OR:
+        case OP_XOR:
+        case OP_XNOR:
+        case OP_ADD:
+        case OP_MUL: {
+            // N-ary, folded left
+            uint64_t result = eval(argsp[0]);
+            for (uint32_t i = 1; i < node.m_nargs; ++i) {
+                const uint64_t value = eval(argsp[i]);
+                switch (node.m_op) {
+                case OP_AND: result &= value; break;
+                case OP_OR: result |= value; break;
+                case OP_XOR: result ^= value; break;
+                case OP_XNOR: result = ~(result ^ value); break;
+                case OP_ADD: result += value; break;
+                default: result *= value; break;  // OP_MUL
+                }
+                // Short circuit 1-bit logic, as in && and ||
+                if (node.m_width == 1 && node.m_op == OP_AND && !(result & 1)) return 0;
+                if (node.m_width == 1 && node.m_op == OP_OR && (result & 1)) return 1;
+            }
+            return result & resultMask;
+        }
+        default: break;
+        }
+        // Binary operators
+        const int width = m_nodes[argsp[0]].m_width;
+        const uint64_t lhs = eval(argsp[0]);
+        const uint64_t rhs = eval(argsp[1]);
+        const int64_t slhs = toSigned(lhs, width);
+        const int64_t srhs = toSigned(rhs, width);
+        switch (node.m_op) {
+        case OP_SUB: return (lhs - rhs) & resultMask;
+        case OP_UDIV: return rhs ? lhs / rhs : resultMask;
+        case OP_UREM: return rhs ? lhs % rhs : lhs;
+        case OP_SDIV: {
+            // Per SMT-LIB, division of magnitudes, then negated if signs differ
+            const uint64_t absLhs = (slhs < 0 ? 0 - lhs : lhs) & resultMask;
+            const uint64_t absRhs = (srhs < 0 ? 0 - rhs : rhs) & resultMask;
+            const uint64_t quotient = absRhs ? absLhs / absRhs : resultMask;
+            return ((slhs < 0) != (srhs < 0) ? 0 - quotient : quotient) & resultMask;
+        }
+        case OP_SMOD: {
+            // Per SMT-LIB, the result has the sign of the divisor
+            const uint64_t absLhs = (slhs < 0 ? 0 - lhs : lhs) & resultMask;
+            const uint64_t absRhs = (srhs < 0 ? 0 - rhs : rhs) & resultMask;
+            const uint64_t rem = absRhs ? absLhs % absRhs : absLhs;
+            if (rem == 0 || (slhs >= 0 && srhs >= 0)) return rem;
+            if (slhs < 0 && srhs >= 0) return (rhs - rem) & resultMask;
+            if (slhs >= 0) return (rem + rhs) & resultMask;
+            return (0 - rem) & resultMask;
+        }
+        case OP_SHL: return rhs >= static_cast<uint64_t>(width) ? 0 : (lhs << rhs) & resultMask;
+        case OP_LSHR: return rhs >= static_cast<uint64_t>(width) ? 0 : lhs >> rhs;
+        case OP_ASHR:
+            return static_cast<uint64_t>(slhs >> std::min<uint64_t>(rhs, 63)) & resultMask;
+        case OP_ULT: return lhs < rhs;
+        case OP_ULE: return lhs <= rhs;
+        case OP_UGT: return lhs > rhs;
+        case OP_UGE: return lhs >= rhs;
+        case OP_SLT: return slhs < srhs;
+        case OP_SLE: return slhs <= srhs;
+        case OP_SGT: return slhs > srhs;
+        case OP_SGE: return slhs >= srhs;
+        default: return 0;
+        }
+    }
+
+    // METHODS - analysis
+    // Split constraint into conjuncts
+    void addConjuncts(uint32_t nodei, std::vector<uint32_t>& conjuncts) const {
+        const Node& node = m_nodes[nodei];
+        if (node.m_width == 1 && (node.m_op == OP_AND || node.m_op == OP_BOOL_AND)) {
+            for (uint32_t i = 0; i < node.m_nargs; ++i) {
+                addConjuncts(m_args[node.m_argsStart + i], conjuncts);
+            }
+            return;
+        }
+        conjuncts.push_back(nodei);
+    }
+    // If the 1-bit node constrains only one variable, against constants, get its values
+    bool domainOf(uint32_t nodei, int& vari, Intervals& result) const {
+        const Node& node = m_nodes[nodei];
+        switch (node.m_op) {
+        case OP_AND:
+        case OP_BOOL_AND:
+        case OP_OR:
+        case OP_BOOL_OR: {
+            if (node.m_width != 1) return false;
+            const bool isAnd = node.m_op == OP_AND || node.m_op == OP_BOOL_AND;
+            for (uint32_t i = 0; i < node.m_nargs; ++i) {
+                Intervals argResult;
+                if (!domainOf(m_args[node.m_argsStart + i], vari, argResult)) return false;
+                result = i == 0 ? argResult
+                                : isAnd ? intersect(result, argResult) : unite(result, argResult);
+            }
+            return true;
+        }
+        case OP_NOT:
+        case OP_BVNOT:
+        case OP_DISTINCT: {
+            if (node.m_width != 1) return false;
+            if (node.m_op == OP_DISTINCT) {
+                if (node.m_nargs != 2 || !compareDomain(OP_EQ, node, vari, result)) return false;
+            } else if (!domainOf(m_args[node.m_argsStart], vari, result)) {
+                return false;
+            }
+            result = complement(result, m_vars[vari].m_mask);
+            return true;
+        }
+        case OP_EQ:
+            if (node.m_nargs != 2) return false;
+            return compareDomain(OP_EQ, node, vari, result);
+        case OP_VAR:
+            // 1-bit variable used as a boolean
+            if (node.m_width != 1 || (vari >= 0 && static_cast<int>(node.m_param) != vari))
+                return false;
+            vari = node.m_param;
+            result = {{1, 1}};
+            return true;
+        default:
+            if (!isCompare(node.m_op)) return false;
+            return compareDomain(node.m_op, node, vari, result);
+        }
+    }
+    bool compareDomain(Op op, const Node& node, int& vari, Intervals& result) const {
+        const Node* varNodep = &arg(node, 0);
+        const Node* constNodep = &arg(node, 1);
+        if (varNodep->m_op == OP_CONST) {
+            std::swap(varNodep, constNodep);
+            op = swapCompare(op);
+        }
+        if (varNodep->m_op != OP_VAR || constNodep->m_op != OP_CONST) return false;
+        if (vari >= 0 && static_cast<int>(varNodep->m_param) != vari) return false;
+        vari = varNodep->m_param;
+        result = compareIntervals(op, constNodep->m_value, varNodep->m_width);
+        return true;
+    }
+    void collectVars(uint32_t nodei, std::set<uint32_t>& vars) const {
+        const Node& node = m_nodes[nodei];
+        if (node.m_op == OP_VAR) vars.insert(node.m_param);
+        for (uint32_t i = 0; i < node.m_nargs; ++i) {
+            collectVars(m_args[node.m_argsStart + i], vars);
+        }
+    }
+
+    // METHODS - tables
+    static double rangeSize(const std::pair<uint64_t, uint64_t>& range) {
+        return static_cast<double>(range.second - range.first) + 1.0;
+    }
+    // Build table choosing from the variable's domain, by its dist weights if any
+    bool buildTable(const Var& var, VlRandomTable& table) const {
+        Intervals ranges;
+        std::vector<double> weights;
+        for (size_t i = 0; i < var.m_ndists; ++i) {
+            const VlRandomDist& dist = var.m_distp[i];
+            const uint64_t lo = dist.m_lo & var.m_mask;
+            const uint64_t hi = dist.m_hi & var.m_mask;
+            const Intervals items = lo <= hi ? Intervals{{lo, hi}}  //
+                                             : Intervals{{0, hi}, {lo, var.m_mask}};
+            double size = 0;
+            for (const auto& item : items) size += rangeSize(item);
+            const double weight = static_cast<double>(dist.m_weight);
+            const double valueWeight = dist.m_whole ? weight / size : weight;
+            for (const auto& range : intersect(var.m_domain, items)) {
+                ranges.push_back(range);
+                weights.push_back(valueWeight * rangeSize(range));
+            }
+        }
+        if (table.build(ranges, weights)) return true;
+        // No weights, so choose uniformly
+        weights.clear();
+        for (const auto& range : var.m_domain) weights.push_back(rangeSize(range));
+        return table.build(var.m_domain, weights);
+    }
+    // Table kept from an earlier call for the constraint, if still valid
+    const VlRandomTable* keptTable(const std::string& constraint, size_t firstDist,
+                                   size_t ndists, int& vari) const {
+        const auto it = m_tables.find(constraint);
+        if (it == m_tables.end()) return nullptr;
+        const VlRandomTable& table = it->second;
+        const auto varIt = m_varIndex.find(table.m_var);
+        if (varIt == m_varIndex.end()) return nullptr;
+        const Var& var = m_vars[varIt->second];
+        if (!var.m_randomize || var.m_mask != table.m_mask || table.m_dists.size() != ndists)
+            return nullptr;
+        for (size_t i = 0; i < ndists; ++i) {
+            if (!table.m_dists[i].sameItem(m_dists[firstDist + i])) return nullptr;
+        }
+        vari = static_cast<int>(varIt->second);
+        return &table;
+    }
+
+    // Solve one independent group, of the given conjuncts over the given variables,
+    // keeping its table under the constraint text if given and it is just a domain
+    Result solveGroup(const std::vector<uint32_t>& conjuncts,
+                      const std::vector<uint32_t>& groupVars, const std::string* keepKeyp,
+                      VlRNG& rngr) {
+        // Domains and definitions
+        std::vector<uint32_t> checks;
+        std::vector<std::set<uint32_t>> checkVars;
+        for (const uint32_t nodei : conjuncts) {
+            int vari = -1;
+            Intervals domain;
+            if (domainOf(nodei, vari, domain) && m_vars[vari].m_randomize) {
+                Var& var = m_vars[vari];
+                var.m_domain = intersect(var.m_domain, domain);
+                if (var.m_domain.empty()) return Result::UNSAT;
+                continue;
+            }
+            const Node& node = m_nodes[nodei];
+            std::set<uint32_t> vars;
+            collectVars(nodei, vars);
+            if (node.m_op == OP_EQ && node.m_nargs == 2) {
+                for (uint32_t side = 0; side < 2; ++side) {
+                    const Node& varNode = arg(node, side);
+                    if (varNode.m_op != OP_VAR) continue;
+                    Var& var = m_vars[varNode.m_param];
+                    if (!var.m_randomize || var.m_defNode >= 0) continue;
+                    std::set<uint32_t> defVars;
+                    const uint32_t defi = m_args[node.m_argsStart + 1 - side];
+                    collectVars(defi, defVars);
+                    if (defVars.count(varNode.m_param)) continue;
+                    var.m_defNode = defi;
+                    var.m_defCheck = static_cast<int>(checks.size());
+                    break;
+                }
+            }
+            checks.push_back(nodei);
+            checkVars.push_back(std::move(vars));
+        }
+
+        // Order chosen variables first, then defined variables after those they depend on
+        std::vector<uint32_t> order;
+        for (const uint32_t vari : groupVars) {
+            Var& var = m_vars[vari];
+            if (!var.m_randomize || var.m_defNode >= 0) continue;
+            var.m_pos = static_cast<int>(order.size());
+            order.push_back(vari);
+        }
+        for (bool progress = true; progress;) {
+            progress = false;
+            for (const uint32_t vari : groupVars) {
+                Var& var = m_vars[vari];
+                if (var.m_defNode < 0 || var.m_pos >= 0) continue;
+                bool ready = true;
+                for (const uint32_t depi : checkVars[var.m_defCheck]) {
+                    if (depi != vari && m_vars[depi].m_randomize && m_vars[depi].m_pos < 0)
+                        ready = false;
+                }
+                if (!ready) continue;
+                var.m_pos = static_cast<int>(order.size());
+                order.push_back(vari);
+                progress = true;
+            }
+        }
+        std::vector<bool> defined(checks.size(), false);
+        for (const uint32_t vari : groupVars) {
+            Var& var = m_vars[vari];
+            if (var.m_defNode < 0) continue;
+            if (var.m_pos < 0) {
+                // Dependency cycle, so choose randomly
+                var.m_defNode = -1;
+                var.m_pos = static_cast<int>(order.size());
+                order.push_back(vari);
+            } else {
+                defined[var.m_defCheck] = true;  // Holds by construction
+            }
+        }
+
+        // Check each constraint once its last variable is chosen
+        std::vector<std::vector<uint32_t>> posChecks(order.size());
+        for (size_t i = 0; i < checks.size(); ++i) {
+            if (defined[i]) continue;
+            int pos = -1;
+            for (const uint32_t vari : checkVars[i]) pos = std::max(pos, m_vars[vari].m_pos);
+            if (pos < 0) {
+                if (!eval(checks[i])) return Result::UNSAT;  // Only constants
+                continue;
+            }
+            posChecks[pos].push_back(checks[i]);
+        }
+
+        // Tables choosing values by dist weight, or to keep for later calls
+        const bool keep = keepKeyp && order.size() == 1 && checks.empty()
+                          && m_vars[order[0]].m_defNode < 0 && m_tables.size() < MAX_TABLES;
+        std::vector<VlRandomTable> tables;
+        tables.reserve(order.size());
+        for (const uint32_t vari : order) {
+            Var& var = m_vars[vari];
+            if (var.m_defNode >= 0 || (!var.m_ndists && !keep)) continue;
+            tables.emplace_back();
+            if (!buildTable(var, tables.back())) return Result::UNSAT;
+            var.m_tablep = &tables.back();
+            if (keep) {
+                VlRandomTable& kept = m_tables[*keepKeyp];
+                kept = std::move(tables.back());
+                kept.m_var = *var.m_namep;
+                kept.m_mask = var.m_mask;
+                kept.m_dists.assign(var.m_distp, var.m_distp + var.m_ndists);
+                var.m_tablep = &kept;
+            }
+        }
+
+        // Search
+        std::vector<uint32_t> tries(order.size(), 0);
+        uint32_t steps = 0;
+        size_t pos = 0;
+        while (pos < order.size()) {
+            const uint32_t vari = order[pos];
+            const Var& var = m_vars[vari];
+            bool ok = true;
+            if (var.m_defNode >= 0) {
+                m_values[vari] = eval(var.m_defNode) & var.m_mask;
+                ok = contains(var.m_domain, m_values[vari]);
+            } else if (var.m_tablep) {
+                m_values[vari] = var.m_tablep->sample(rngr);
+            } else {
+                // Choose range in proportion to its size, then a value in it
+                uint64_t total = 0;
+                for (const auto& range : var.m_domain) total += range.second - range.first + 1;
+                uint64_t offset = randomBelow(rngr, total);
+                for (const auto& range : var.m_domain) {
+                    const uint64_t size = range.second - range.first + 1;
+                    if (size != 0 && offset >= size) {
+                        offset -= size;
+                        continue;
+                    }
+                    m_values[vari] = range.first + offset;
+                    break;
+                }
+            }
+            for (const uint32_t checki : posChecks[pos]) {
+                if (!ok) break;
+                ok = eval(checki);
+            }
+            if (ok) {
+                ++pos;
+                continue;
+            }
+            if (++steps > MAX_STEPS) return Result::UNKNOWN;
+            // Choose again, or backtrack if this variable was tried enough, the
+            // first variable being chosen again until the steps run out
+            while (m_vars[order[pos]].m_defNode >= 0 || ++tries[pos] >= MAX_TRIES) {
+                tries[pos] = 0;
+                if (pos == 0) {
+                    if (m_vars[order[pos]].m_defNode >= 0) return Result::UNKNOWN;
+                    break;
+                }
+                --pos;
+            }
+        }
+        m_solved.insert(m_solved.end(), order.begin(), order.end());
+        return Result::SAT;
+    }
+
+public:
+    // CONSTRUCTORS
+    VlRandomFastSolver(const std::map<std::string, std::shared_ptr<const VlRandomVar>>& vars,
+                       const VlQueue<CData>* randmodep, const std::vector<VlRandomDist>& dists,
+                       std::unordered_map<std::string, VlRandomTable>& tables)
+        : m_dists{dists}
+        , m_tables{tables} {
+        for (const auto& it : vars) {
+            const VlRandomVar& var = *it.second;
+            if (var.dimension() > 0 || var.width() > VL_QUADSIZE || var.width() < 1) {
+                m_ok = false;
+                return;
+            }
+            Var info;
+            info.m_varp = &var;
+            info.m_namep = &it.first;
+            info.m_mask = mask(var.width());
+            info.m_domain = {{0, info.m_mask}};
+            info.m_randomize = !randmodep || var.randModeIdxNone()
+                               || randmodep->at(var.randModeIdx());
+            m_varIndex.emplace(it.first, static_cast<uint32_t>(m_vars.size()));
+            m_vars.push_back(info);
+            m_values.push_back(info.m_randomize ? 0 : readVar(var));
+        }
+    }
+
+    // METHODS
+    // Solve each independent group of constraints.  UNKNOWN if any group needs
+    // the external solver, see unsupported() and externalConstraints().
+    Result solve(const std::vector<std::string>& constraints, VlRNG& rngr) {
+        if (!m_ok) return Result::UNKNOWN;
+        // Parse, except constraints with a kept table, parsed only if they
+        // turn out to share their variable with other constraints
+        std::vector<uint32_t> roots(constraints.size(), NOT_PARSED);
+        const auto parse = [&](size_t i) {
+            m_curp = constraints[i].c_str();
+            const uint32_t rooti = parseExpr();
+            if (!m_ok || m_nodes[rooti].m_width != 1 || token().m_len != 0) m_ok = false;
+            roots[i] = rooti;
+            return m_ok;
+        };
+        std::vector<const VlRandomTable*> kept(constraints.size(), nullptr);
+        std::vector<int> keptVar(constraints.size(), -1);
+        std::vector<std::pair<size_t, size_t>> dists(constraints.size(), {0, 0});
+        size_t disti = 0;
+        for (size_t i = 0; i < constraints.size(); ++i) {
+            while (disti < m_dists.size() && m_dists[disti].m_constraint < i) ++disti;
+            dists[i].first = disti;
+            while (disti < m_dists.size() && m_dists[disti].m_constraint == i) ++disti;
+            dists[i].second = disti - dists[i].first;
+            kept[i] = keptTable(constraints[i], dists[i].first, dists[i].second, keptVar[i]);
+            if (!kept[i] && !parse(i)) return Result::UNKNOWN;
+        }
+
+        // Join the variables of each constraint, including inline constraints and those
+        // added by derived classes, into groups
+        std::vector<uint32_t> parents(m_vars.size());
+        for (uint32_t vari = 0; vari < m_vars.size(); ++vari) parents[vari] = vari;
+        const auto findRoot = [&](uint32_t vari) {
+            while (parents[vari] != vari) vari = parents[vari] = parents[parents[vari]];
+            return vari;
+        };
+        std::vector<int> constraintVar(roots.size(), -1);  // A variable of each constraint
+        for (size_t i = 0; i < roots.size(); ++i) {
+            std::set<uint32_t> vars;
+            if (kept[i]) {
+                vars.insert(keptVar[i]);
+            } else {
+                collectVars(roots[i], vars);
+            }
+            if (dists[i].second && vars.size() == 1) {
+                Var& var = m_vars[*vars.begin()];
+                if (!var.m_ndists) {
+                    var.m_distp = &m_dists[dists[i].first];
+                    var.m_ndists = dists[i].second;
+                }
+            }
+            if (vars.empty()) {
+                if (!eval(roots[i])) return Result::UNSAT;  // Only constants
+                continue;
+            }
+            const uint32_t firsti = *vars.begin();
+            for (const uint32_t vari : vars) parents[findRoot(vari)] = findRoot(firsti);
+            constraintVar[i] = firsti;
+        }
+        std::vector<std::vector<uint32_t>> rootVars(m_vars.size());
+        for (uint32_t vari = 0; vari < m_vars.size(); ++vari) {
+            rootVars[findRoot(vari)].push_back(vari);
+        }
+        std::vector<std::vector<uint32_t>> rootConstraints(m_vars.size());
+        for (uint32_t i = 0; i < roots.size(); ++i) {
+            if (constraintVar[i] >= 0) rootConstraints[findRoot(constraintVar[i])].push_back(i);
+        }
+
+        // Solve each group, leaving those needing search beyond the limits
+        std::vector<uint32_t> conjuncts;
+        for (uint32_t rooti = 0; rooti < m_vars.size(); ++rooti) {
+            if (rootVars[rooti].empty()) continue;
+            const std::vector<uint32_t>& groupConstraints = rootConstraints[rooti];
+            if (groupConstraints.size() == 1 && kept[groupConstraints[0]]
+                && rootVars[rooti].size() == 1) {
+                const uint32_t vari = rootVars[rooti][0];
+                m_values[vari] = kept[groupConstraints[0]]->sample(rngr);
+                m_solved.push_back(vari);
+                continue;
+            }
+            conjuncts.clear();
+            for (const uint32_t i : groupConstraints) {
+                if (roots[i] == NOT_PARSED && !parse(i)) return Result::UNKNOWN;
+                addConjuncts(roots[i], conjuncts);
+            }
+            const std::string* const keepKeyp
+                = groupConstraints.size() == 1 ? &constraints[groupConstraints[0]] : nullptr;
+            const Result result = solveGroup(conjuncts, rootVars[rooti], keepKeyp, rngr);
+            if (result == Result::UNSAT) return Result::UNSAT;
+            if (result == Result::SAT) continue;
+            m_external.insert(m_external.end(), rootConstraints[rooti].begin(),
+                              rootConstraints[rooti].end());
+            for (const uint32_t vari : rootVars[rooti]) {
+                m_externalVars.insert(*m_vars[vari].m_namep);
+            }
+        }
+        if (m_external.empty()) return Result::SAT;
+        std::sort(m_external.begin(), m_external.end());
+        return Result::UNKNOWN;
+    }
+    // Constraints are outside the subset, so none were solved
+    bool unsupported() const { return !m_ok; }
+    // Constraints of groups left for the external solver, by index
+    const std::vector<uint32_t>& externalConstraints() const { return m_external; }
+    // Variables of groups left for the external solver
+    const std::set<std::string>& externalVars() const { return m_externalVars; }
+    // Write the values of variables solved in-process
+    void write() const {
+        for (const uint32_t vari : m_solved) writeVar(*m_vars[vari].m_varp, m_values[vari]);
+    }
+};
+
 //======================================================================
 // VlRandomizer:: Methods
 
@@ -342,7 +1461,9 @@ bool VlRandomVar::set(const std::string& idx, const std::string& val) const {
 void VlRandomizer::randomConstraint(std::ostream& os, VlRNG& rngr, int bits) {
     const IData hash = VL_RANDOM_RNG_I(rngr) & ((1 << bits) - 1);
     int varBits = 0;
-    for (const auto& var : m_vars) varBits += var.second->totalWidth();
+    for (const auto& var : m_vars) {
+        if (solverVar(var.first)) varBits += var.second->totalWidth();
+    }
     os << "(= #b";
     for (int i = bits - 1; i >= 0; i--) os << (VL_BITISSET_I(hash, i) ? '1' : '0');
     if (bits > 1) os << " (concat";
@@ -351,6 +1472,7 @@ void VlRandomizer::randomConstraint(std::ostream& os, VlRNG& rngr, int bits) {
         IData varBitsWant = (varBits + 1) / 2;
         if (varBits > 2) os << " (bvxor";
         for (const auto& var : m_vars) {
+            if (!solverVar(var.first)) continue;
             for (int j = 0; j < var.second->totalWidth(); j++, varBitsLeft--) {
                 const bool doEmit = (VL_RANDOM_RNG_I(rngr) % varBitsLeft) < varBitsWant;
                 if (doEmit) {
@@ -368,30 +1490,87 @@ void VlRandomizer::randomConstraint(std::ostream& os, VlRNG& rngr, int bits) {
 
 bool VlRandomizer::next(VlRNG& rngr) {
     if (m_vars.empty()) return true;
-    std::iostream& os = getSolver();
+    if (!Verilated::threadContextp()->solverFast()) return nextSolver(rngr, m_constraints);
+    VlRandomFastSolver fastSolver{m_vars, m_randmodep, m_dists, m_tables};
+    const VlRandomFastSolver::Result result = fastSolver.solve(m_constraints, rngr);
+    if (result == VlRandomFastSolver::Result::UNSAT) return false;
+    if (result == VlRandomFastSolver::Result::UNKNOWN) {
+        if (fastSolver.unsupported()) return nextSolver(rngr, m_constraints);
+        // Only groups not solved in-process go to the solver
+        std::vector<std::string> constraints;
+        for (const uint32_t i : fastSolver.externalConstraints()) {
+            constraints.push_back(m_constraints[i]);
+        }
+        m_solverVarsp = &fastSolver.externalVars();
+        const bool sat = nextSolver(rngr, constraints);
+        m_solverVarsp = nullptr;
+        if (!sat) return false;
+    }
+    fastSolver.write();
+    return true;
+}
+
+bool VlRandomizer::nextSolver(VlRNG& rngr, const std::vector<std::string>& constraints) {
+    VlRSolver& solver = getThreadSolver();
+    const VerilatedLockGuard lock{solver.m_mutex};
+    std::iostream& os = getSolver(solver);
     if (!os) return false;
+    VlRSolverSession& session = solver.m_session;
+    const bool incremental = Verilated::threadContextp()->solverIncremental();
 
-    os << "(set-option :produce-models true)\n";
-    os << "(set-logic QF_ABV)\n";
-    os << "(define-fun __Vbv ((b Bool)) (_ BitVec 1) (ite b #b1 #b0))\n";
-    os << "(define-fun __Vbool ((v (_ BitVec 1))) Bool (= #b1 v))\n";
+    // A name declared with another type, e.g. by another class, needs a restart
+    std::vector<std::pair<const std::string*, std::string>> types;
     for (const auto& var : m_vars) {
+        if (!solverVar(var.first)) continue;
         if (var.second->dimension() > 0) {
             auto arrVarsp = std::make_shared<const ArrayInfoMap>(m_arr_vars);
             var.second->setArrayInfo(arrVarsp);
         }
-        os << "(declare-fun " << var.first << " () ";
-        var.second->emitType(os);
-        os << ")\n";
+        std::ostringstream type;
+        var.second->emitType(type);
+        const auto it = session.m_declared.find(var.first);
+        if (it != session.m_declared.end() && it->second != type.str()) session.reset(os);
+        types.emplace_back(&var.first, type.str());
+    }
+    if (!session.m_started) {
+        os << "(set-option :produce-models true)\n";
+        os << "(set-logic QF_ABV)\n";
+        os << "(define-fun __Vbv ((b Bool)) (_ BitVec 1) (ite b #b1 #b0))\n";
+        os << "(define-fun __Vbool ((v (_ BitVec 1))) Bool (= #b1 v))\n";
+        session.m_started = true;
+    }
+    // Declarations are outside the outer level, so pop does not remove them
+    bool declare = false;
+    for (const auto& type : types) declare |= !session.m_declared.count(*type.first);
+    if (declare) {
+        session.popOuter(os);
+        for (const auto& type : types) {
+            if (session.m_declared.emplace(*type.first, type.second).second) {
+                os << "(declare-fun " << *type.first << " () " << type.second << ")\n";
+            }
+        }
+    }
+    // Constraints unchanged since the previous call stay in the outer level
+    size_t keep = 0;
+    if (incremental) {
+        while (keep < session.m_asserted.size() && keep < constraints.size()
+               && session.m_asserted[keep] == constraints[keep])
+            ++keep;
+        if (keep < session.m_asserted.size()) {
+            session.popOuter(os);
+            session.m_asserted.resize(keep);
+        }
+        session.pushOuter(os);
+        os << "(push 1)\n";
     }
-    for (const std::string& constraint : m_constraints) {
-        os << "(assert (= #b1 " << constraint << "))\n";
+    for (size_t i = keep; i < constraints.size(); ++i) {
+        os << "(assert (= #b1 " << constraints[i] << "))\n";
     }
     os << "(check-sat)\n";
 
     bool sat = parseSolution(os);
     if (!sat) {
-        os << "(reset)\n";
+        session.reset(os);
         return false;
     }
     for (int i = 0; i < _VL_SOLVER_HASH_LEN_TOTAL && sat; ++i) {
@@ -402,7 +1581,19 @@ bool VlRandomizer::next(VlRNG& rngr) {
         sat = parseSolution(os);
     }
 
-    os << "(reset)\n";
+    if (!incremental) {
+        session.reset(os);
+        return true;
+    }
+    os << "(pop 1)\n";
+    // Constraints repeated from the previous call are likely to repeat again
+    for (size_t i = keep; i < constraints.size() && i < session.m_previous.size()
+                          && constraints[i] == session.m_previous[i];
+         ++i) {
+        os << "(assert (= #b1 " << constraints[i] << "))\n";
+        session.m_asserted.push_back(constraints[i]);
+    }
+    session.m_previous = constraints;
     return true;
 }
 
@@ -421,6 +1612,7 @@ bool VlRandomizer::parseSolution(std::iostream& os) {
 
     os << "(get-value (";
     for (const auto& var : m_vars) {
+        if (!solverVar(var.first)) continue;
         if (var.second->dimension() > 0) {
             auto arrVarsp = std::make_shared<const ArrayInfoMap>(m_arr_vars);
             var.second->setArrayInfo(arrVarsp);
@@ -507,11 +1699,14 @@ void VlRandomizer::hard(std::string&& constraint) {
 
 void VlRandomizer::clearConstraints() {
     m_constraints.clear();
+    m_dists.clear();
     // Keep m_vars for class member randomization
 }
 
 void VlRandomizer::clearAll() {
     m_constraints.clear();
+    m_dists.clear();
+    m_tables.clear();
     m_vars.clear();
 }
 
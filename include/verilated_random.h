@@ -30,7 +30,9 @@
 #include <iomanip>
 #include <iostream>
 #include <ostream>
+#include <set>
 #include <sstream>
+#include <unordered_map>
 
 //=============================================================================
 
@@ -196,17 +198,70 @@ public:
 
 //=============================================================================
 
+// Item of a dist constraint on a single variable, with constant weight
+struct VlRandomDist final {
+    uint32_t m_constraint;  // Index of dist constraint
+    uint64_t m_lo;  // Lowest value, above m_hi if a signed range wraps
+    uint64_t m_hi;  // Highest value
+    uint64_t m_weight;  // Weight
+    bool m_whole;  // Weight is for whole range (':/'), else each value (':=')
+    bool sameItem(const VlRandomDist& other) const {
+        return m_lo == other.m_lo && m_hi == other.m_hi && m_weight == other.m_weight
+               && m_whole == other.m_whole;
+    }
+};
+
+// Walker alias table choosing a range of values by weight in O(1) time,
+// then a value in the range uniformly
+class VlRandomTable final {
+    // MEMBERS
+    std::vector<std::pair<uint64_t, uint64_t>> m_ranges;  // Inclusive ranges of values
+    std::vector<double> m_probs;  // Probability of keeping each column, else its alias
+    std::vector<uint32_t> m_aliases;  // Range chosen instead of each column
+
+public:
+    // When kept for a constraint, what the table was built for
+    std::string m_var;  // Variable name
+    uint64_t m_mask = 0;  // Mask of variable width
+    std::vector<VlRandomDist> m_dists;  // Dist items, if any
+
+    // CONSTRUCTORS
+    VlRandomTable() = default;
+    // For a variable Verilator found is only compared to constants
+    VlRandomTable(const std::vector<std::pair<uint64_t, uint64_t>>& ranges,
+                  const std::vector<double>& weights) {
+        build(ranges, weights);
+    }
+
+    // METHODS
+    // Build from ranges and their weights, returns false if all weights are zero
+    bool build(const std::vector<std::pair<uint64_t, uint64_t>>& ranges,
+               const std::vector<double>& weights);
+    uint64_t sample(VlRNG& rngr) const;
+};
+
+//=============================================================================
+
 // Object holding constraints and variable references.
 class VlRandomizer VL_NOT_FINAL {
     // MEMBERS
     std::vector<std::string> m_constraints;  // Solver-dependent constraints
+    std::vector<VlRandomDist> m_dists;  // Weights of dist constraints, by constraint order
+    std::unordered_map<std::string, VlRandomTable> m_tables;  // Sampling tables of single
+                                                              // variable constraints
     std::map<std::string, std::shared_ptr<const VlRandomVar>> m_vars;  // Solver-dependent
                                                                        // variables
     ArrayInfoMap m_arr_vars;  // Tracks each element in array structures for iteration
     const VlQueue<CData>* m_randmodep = nullptr;  // rand_mode state;
     int m_index = 0;  // Internal counter for key generation
+    const std::set<std::string>* m_solverVarsp = nullptr;  // Variables given to solver,
+                                                           // nullptr for all
 
     // PRIVATE METHODS
+    bool solverVar(const std::string& name) const {
+        return !m_solverVarsp || m_solverVarsp->count(name);
+    }
+    bool nextSolver(VlRNG& rngr, const std::vector<std::string>& constraints);
     void randomConstraint(std::ostream& os, VlRNG& rngr, int bits);
     bool parseSolution(std::iostream& file);
 
@@ -570,6 +625,11 @@ public:
     }
 
     void hard(std::string&& constraint);
+    // Add weight of values lo to hi of the last constraint, a dist on a single variable
+    void dist(QData lo, QData hi, QData weight, bool whole) {
+        m_dists.push_back({static_cast<uint32_t>(m_constraints.size() - 1), lo, hi, weight,
+                           whole});
+    }
     void clearConstraints();
     void clearAll();  // Clear both constraints and variables
     void set_randmode(const VlQueue<CData>& randmode) { m_randmodep = &randmode; }
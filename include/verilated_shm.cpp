@@ -0,0 +1,290 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//=============================================================================
+//
+// Code available from: https://verilator.org
+//
+// Copyright 2026 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//=============================================================================
+///
+/// \file
+/// \brief Verilated shared-memory co-simulation bridge implementation code
+///
+/// This file must be compiled and linked against all Verilated objects
+/// that use verilated_shm.h.
+///
+//=============================================================================
+
+#include "verilatedos.h"
+
+#include "verilated_shm.h"
+
+#include "verilated_syms.h"
+
+#include <cerrno>
+#include <new>
+
+//=============================================================================
+// Helpers
+
+static uint32_t vl_shm_storage_bytes(int bits) {
+    if (bits <= 8) return sizeof(CData);
+    if (bits <= 16) return sizeof(SData);
+    if (bits <= 32) return sizeof(IData);
+    if (bits <= 64) return sizeof(QData);
+    return VL_WORDS_I(bits) * sizeof(EData);
+}
+
+static uint64_t vl_shm_align(uint64_t bytes) {
+    return (bytes + VL_SHM_ALIGN - 1) & ~static_cast<uint64_t>(VL_SHM_ALIGN - 1);
+}
+
+// Store a value masked to its width, returning true if it changed
+template <typename T>
+static bool vl_shm_put(void* datap, const uint8_t* srcp, T mask) {
+    T value;
+    std::memcpy(&value, srcp, sizeof(T));
+    value &= mask;
+    if (*static_cast<T*>(datap) == value) return false;
+    *static_cast<T*>(datap) = value;
+    return true;
+}
+
+//=============================================================================
+// VerilatedShmServer
+
+bool VerilatedShmServer::addScoped(const char* namep, bool input) VL_MT_UNSAFE_ONE {
+    m_assertOne.check();
+    const char* const dotp = std::strrchr(namep, '.');
+    if (VL_UNLIKELY(!dotp)) return false;
+    const std::string scopeName{namep, static_cast<size_t>(dotp - namep)};
+    const VerilatedScope* const scopep = m_contextp->scopeFind(scopeName.c_str());
+    if (VL_UNLIKELY(!scopep)) return false;
+    const VerilatedVar* const varp = scopep->varFind(dotp + 1);
+    if (VL_UNLIKELY(!varp)) return false;
+    // Only whole packed values, as the client sees them as words
+    if (VL_UNLIKELY(varp->udims() || varp->vltype() < VLVT_UINT8
+                    || varp->vltype() > VLVT_WDATA))
+        return false;
+    if (VL_UNLIKELY(input && !varp->isPublicRW())) return false;
+    add(namep, varp->datap(), varp->entBits(), input);
+    (input ? m_inputs : m_outputs).back().m_dirtyp = varp->dirtyp();
+    return true;
+}
+
+void VerilatedShmServer::add(const char* namep, void* datap, int bits,
+                             bool input) VL_MT_UNSAFE_ONE {
+    m_assertOne.check();
+    if (VL_UNLIKELY(isOpen())) {
+        VL_FATAL_MT(__FILE__, __LINE__, "", "VerilatedShmServer: Signal added after open()");
+    }
+    uint32_t& bytes = input ? m_inputBytes : m_outputBytes;
+    Signal signal;
+    signal.m_name = namep;
+    signal.m_datap = datap;
+    signal.m_dirtyp = nullptr;
+    signal.m_offset = bytes;
+    signal.m_bits = bits;
+    bytes += vl_shm_storage_bytes(bits);
+    (input ? m_inputs : m_outputs).push_back(signal);
+}
+
+void VerilatedShmServer::open(const char* filenamep, uint32_t ringEntries) VL_MT_UNSAFE_ONE {
+    m_assertOne.check();
+    if (isOpen()) return;
+    VL_DEBUG_IF(VL_DBG_MSGF("- shm: opening shared memory file %s\n", filenamep););
+#ifdef VL_SHM_UNSUPPORTED
+    VL_FATAL_MT(filenamep, 0, "", "VerilatedShmServer: Unsupported on this platform");
+#else
+    uint32_t entries = 1;
+    while (entries < ringEntries) entries <<= 1;
+
+    // Compute layout
+    const size_t nsignals = m_inputs.size() + m_outputs.size();
+    uint64_t namesBytes = 0;
+    for (const Signal& signal : m_inputs) namesBytes += signal.m_name.size() + 1;
+    for (const Signal& signal : m_outputs) namesBytes += signal.m_name.size() + 1;
+    const uint64_t namesOffset
+        = sizeof(VerilatedShmHeader) + nsignals * sizeof(VerilatedShmSignal);
+    const uint64_t requestBytes = VL_SHM_ALIGN + vl_shm_align(m_inputBytes);
+    const uint64_t responseBytes = VL_SHM_ALIGN + vl_shm_align(m_outputBytes);
+    const uint64_t requestOffset = vl_shm_align(namesOffset + namesBytes);
+    const uint64_t responseOffset = requestOffset + entries * requestBytes;
+    const uint64_t totalBytes = responseOffset + entries * responseBytes;
+
+    // Replace any existing file, so a client cannot map a stale one
+    ::unlink(filenamep);
+    const int fd = ::open(filenamep, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (VL_UNLIKELY(fd < 0)) return;  // User code can check isOpen()
+    if (VL_UNLIKELY(::ftruncate(fd, static_cast<off_t>(totalBytes)) != 0)) {
+        ::close(fd);
+        ::unlink(filenamep);
+        return;
+    }
+    void* const mapp
+        = ::mmap(nullptr, totalBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (VL_UNLIKELY(mapp == MAP_FAILED)) {
+        ::unlink(filenamep);
+        return;
+    }
+    m_basep = static_cast<uint8_t*>(mapp);
+    m_bytes = totalBytes;
+    m_filename = filenamep;
+    m_cycle = 0;
+
+    // Fill in signals, then the header, publishing the magic number last
+    VerilatedShmSignal* signalp
+        = reinterpret_cast<VerilatedShmSignal*>(m_basep + sizeof(VerilatedShmHeader));
+    uint64_t nameOffset = namesOffset;
+    for (const std::vector<Signal>* const signalsp : {&m_inputs, &m_outputs}) {
+        for (const Signal& signal : *signalsp) {
+            signalp->m_nameOffset = static_cast<uint32_t>(nameOffset);
+            signalp->m_offset = signal.m_offset;
+            signalp->m_bits = signal.m_bits;
+            signalp->m_input = signalsp == &m_inputs;
+            ++signalp;
+            std::memcpy(m_basep + nameOffset, signal.m_name.c_str(), signal.m_name.size() + 1);
+            nameOffset += signal.m_name.size() + 1;
+        }
+    }
+    VerilatedShmHeader* const hp = new (m_basep) VerilatedShmHeader;
+    hp->m_version = VL_SHM_VERSION;
+    hp->m_signals = static_cast<uint32_t>(nsignals);
+    hp->m_ringEntries = entries;
+    hp->m_inputBytes = m_inputBytes;
+    hp->m_outputBytes = m_outputBytes;
+    hp->m_requestBytes = static_cast<uint32_t>(requestBytes);
+    hp->m_responseBytes = static_cast<uint32_t>(responseBytes);
+    hp->m_requestOffset = requestOffset;
+    hp->m_responseOffset = responseOffset;
+    hp->m_totalBytes = totalBytes;
+    hp->m_requestHead.store(0, std::memory_order_relaxed);
+    hp->m_requestTail.store(0, std::memory_order_relaxed);
+    hp->m_responseHead.store(0, std::memory_order_relaxed);
+    hp->m_responseTail.store(0, std::memory_order_relaxed);
+    hp->m_magic.store(VL_SHM_MAGIC, std::memory_order_release);
+#endif
+}
+
+void VerilatedShmServer::close() VL_MT_UNSAFE_ONE {
+    m_assertOne.check();
+    if (!isOpen()) return;
+#ifndef VL_SHM_UNSUPPORTED
+    // Any waiting client sees the server has gone
+    headerp()->m_requestHead.fetch_or(VL_SHM_CLOSED, std::memory_order_release);
+    ::munmap(m_basep, m_bytes);
+    ::unlink(m_filename.c_str());
+#endif
+    m_basep = nullptr;
+}
+
+void VerilatedShmServer::writeInputs(const uint8_t* valuesp) VL_MT_UNSAFE_ONE {
+    for (const Signal& signal : m_inputs) {
+        const uint8_t* const srcp = valuesp + signal.m_offset;
+        bool changed;
+        if (signal.m_bits <= 8) {
+            changed = vl_shm_put<CData>(signal.m_datap, srcp, VL_MASK_I(signal.m_bits));
+        } else if (signal.m_bits <= 16) {
+            changed = vl_shm_put<SData>(signal.m_datap, srcp, VL_MASK_I(signal.m_bits));
+        } else if (signal.m_bits <= 32) {
+            changed = vl_shm_put<IData>(signal.m_datap, srcp, VL_MASK_I(signal.m_bits));
+        } else if (signal.m_bits <= 64) {
+            changed = vl_shm_put<QData>(signal.m_datap, srcp, VL_MASK_Q(signal.m_bits));
+        } else {
+            EData* const wordsp = static_cast<EData*>(signal.m_datap);
+            const int words = VL_WORDS_I(signal.m_bits);
+            changed = false;
+            for (int w = 0; w < words; ++w) {
+                const EData mask = (w == words - 1) ? VL_MASK_E(signal.m_bits) : ~EData{0};
+                changed |= vl_shm_put<EData>(wordsp + w, srcp + w * sizeof(EData), mask);
+            }
+        }
+        // Written other than by the model, so set any --vpi-change-hooks flag
+        if (changed && signal.m_dirtyp) *signal.m_dirtyp = 1;
+    }
+}
+
+void VerilatedShmServer::readOutputs(uint8_t* valuesp) const VL_MT_UNSAFE_ONE {
+    for (const Signal& signal : m_outputs) {
+        std::memcpy(valuesp + signal.m_offset, signal.m_datap,
+                    vl_shm_storage_bytes(signal.m_bits));
+    }
+}
+
+bool VerilatedShmServer::respond(uint64_t index, bool finished) VL_MT_UNSAFE_ONE {
+    VerilatedShmHeader* const hp = headerp();
+    // The client may still hold the oldest response slot
+    VerilatedShmWait wait{m_timeoutMs};
+    while (index - hp->m_responseTail.load(std::memory_order_acquire) >= hp->m_ringEntries) {
+        if (VL_UNLIKELY(!wait.pause())) {
+            m_timedOut = true;
+            return false;
+        }
+    }
+    uint8_t* const rspEntryp = m_basep + hp->m_responseOffset
+                               + (index & (hp->m_ringEntries - 1)) * hp->m_responseBytes;
+    VerilatedShmResponse* const rspp = reinterpret_cast<VerilatedShmResponse*>(rspEntryp);
+    rspp->m_cycle = m_cycle;
+    rspp->m_time = m_contextp->time();
+    rspp->m_flags = finished ? VL_SHM_FINISH : 0;
+    readOutputs(rspEntryp + VL_SHM_ALIGN);
+    hp->m_requestTail.store(index + 1, std::memory_order_release);
+    hp->m_responseHead.store(index + 1, std::memory_order_release);
+    return true;
+}
+
+uint64_t VerilatedShmServer::serve() VL_MT_UNSAFE_ONE {
+    m_assertOne.check();
+    if (VL_UNLIKELY(!isOpen())) return m_cycle;
+    if (VL_UNLIKELY(!m_stepCb)) {
+        VL_FATAL_MT(__FILE__, __LINE__, "", "VerilatedShmServer: serve() called before stepCb()");
+    }
+    VerilatedShmHeader* const hp = headerp();
+    // Accept requests again if a previous serve() closed the ring
+    hp->m_requestHead.fetch_and(~VL_SHM_CLOSED, std::memory_order_relaxed);
+    uint64_t next = hp->m_requestTail.load(std::memory_order_relaxed);
+    m_timedOut = false;
+    bool finished = false;
+    while (!finished) {
+        VerilatedShmWait wait{m_timeoutMs};
+        while (hp->m_requestHead.load(std::memory_order_acquire) == next) {
+            if (VL_UNLIKELY(!wait.pause())) {
+                m_timedOut = true;
+                break;
+            }
+        }
+        if (VL_UNLIKELY(m_timedOut)) break;
+        const uint8_t* const reqEntryp = m_basep + hp->m_requestOffset
+                                         + (next & (hp->m_ringEntries - 1)) * hp->m_requestBytes;
+        const VerilatedShmRequest* const reqp
+            = reinterpret_cast<const VerilatedShmRequest*>(reqEntryp);
+        if (reqp->m_flags & VL_SHM_WRITE) writeInputs(reqEntryp + VL_SHM_ALIGN);
+        for (uint32_t i = 0; i < reqp->m_cycles && !m_contextp->gotFinish(); ++i) {
+            m_stepCb(m_stepUserp);
+            ++m_cycle;
+        }
+        finished = (reqp->m_flags & VL_SHM_FINISH) || m_contextp->gotFinish();
+        if (VL_UNLIKELY(!respond(next++, finished))) break;
+    }
+    // Answer any requests the client pipelined behind the finishing one,
+    // without running them, then close the ring so no more can be sent
+    uint64_t head = hp->m_requestHead.load(std::memory_order_acquire);
+    while (!m_timedOut) {
+        while (next != head && respond(next, true)) ++next;
+        if (m_timedOut
+            || hp->m_requestHead.compare_exchange_weak(head, head | VL_SHM_CLOSED,
+                                                       std::memory_order_acq_rel)) {
+            break;
+        }
+    }
+    if (VL_UNLIKELY(m_timedOut)) {
+        VL_DEBUG_IF(VL_DBG_MSGF("- shm: client timed out, returning from serve()\n"););
+        hp->m_requestHead.fetch_or(VL_SHM_CLOSED, std::memory_order_release);
+    }
+    return m_cycle;
+}
@@ -0,0 +1,141 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//=============================================================================
+//
+// Code available from: https://verilator.org
+//
+// Copyright 2026 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//=============================================================================
+///
+/// \file
+/// \brief Verilated shared-memory co-simulation bridge header
+///
+/// This must be included in user wrapper code that serves a model to an
+/// out-of-process testbench through shared memory, and verilated_shm.cpp
+/// compiled with the model.  The testbench uses verilated_shm_client.h,
+/// which also describes the shared memory layout.
+///
+//=============================================================================
+
+#ifndef VERILATOR_VERILATED_SHM_H_
+#define VERILATOR_VERILATED_SHM_H_
+
+#include "verilatedos.h"
+
+#include "verilated.h"
+#include "verilated_shm_client.h"
+
+#include <string>
+#include <vector>
+
+//=============================================================================
+// VerilatedShmServer
+/// Serve a model's signals to a VerilatedShmClient through shared memory.
+///
+/// Signals are added, then open() creates the shared memory file, then
+/// serve() processes requests until the client calls finish() or the
+/// model calls $finish, or the client has been idle for timeoutMs().
+/// Each request may write the input signals, then calls the step callback
+/// once per cycle, then reads the output signals.
+///
+/// This class is not thread safe, it must be called by a single thread.
+
+class VerilatedShmServer final {
+public:
+    // TYPES
+    using StepCb = void (*)(void* userp);  // Advance the model one cycle
+
+private:
+    struct Signal final {
+        std::string m_name;  // Name given to client
+        void* m_datap;  // Variable's storage
+        uint8_t* m_dirtyp;  // --vpi-change-hooks flag, or nullptr
+        uint32_t m_offset;  // Offset in request or response values
+        uint32_t m_bits;  // Width
+    };
+
+    // MEMBERS
+    VerilatedContext* const m_contextp;  // Context of model
+    std::vector<Signal> m_inputs;  // Signals written by requests
+    std::vector<Signal> m_outputs;  // Signals read into responses
+    uint32_t m_inputBytes = 0;  // Bytes of values in a request
+    uint32_t m_outputBytes = 0;  // Bytes of values in a response
+    StepCb m_stepCb = nullptr;  // Advance one cycle
+    void* m_stepUserp = nullptr;  // User data for m_stepCb
+    std::string m_filename;  // Shared memory file
+    uint8_t* m_basep = nullptr;  // Mapped file
+    size_t m_bytes = 0;  // Size of mapping
+    uint64_t m_cycle = 0;  // Cycles advanced
+    uint32_t m_timeoutMs = 10000;  // Longest wait for the client, 0 for no limit
+    bool m_timedOut = false;  // serve() returned as the client was idle
+    VerilatedAssertOneThread m_assertOne;  // Assert only called from single thread
+
+    // METHODS
+    VerilatedShmHeader* headerp() const { return reinterpret_cast<VerilatedShmHeader*>(m_basep); }
+    bool addScoped(const char* namep, bool input) VL_MT_UNSAFE_ONE;
+    void add(const char* namep, void* datap, int bits, bool input) VL_MT_UNSAFE_ONE;
+    void writeInputs(const uint8_t* valuesp) VL_MT_UNSAFE_ONE;
+    void readOutputs(uint8_t* valuesp) const VL_MT_UNSAFE_ONE;
+    bool respond(uint64_t index, bool finished) VL_MT_UNSAFE_ONE;
+
+public:
+    // CONSTRUCTORS
+    explicit VerilatedShmServer(VerilatedContext* contextp)
+        : m_contextp{contextp} {}
+    ~VerilatedShmServer() { close(); }
+    VL_UNCOPYABLE(VerilatedShmServer);
+
+    // METHODS - signals, before open()
+    /// Add a public variable, named as in scopesDump(), e.g. "TOP.t.sig",
+    /// as an input written by requests.  Returns false if not found or
+    /// not public_flat_rw.
+    bool addInput(const char* namep) VL_MT_UNSAFE_ONE { return addScoped(namep, true); }
+    /// Add a public variable as an output read into responses.
+    /// Returns false if not found.
+    bool addOutput(const char* namep) VL_MT_UNSAFE_ONE { return addScoped(namep, false); }
+    /// Add a variable of the given width by reference, e.g. a top-level
+    /// port as &topp->clk, as an input written by requests
+    void addInput(const char* namep, void* datap, int bits) VL_MT_UNSAFE_ONE {
+        add(namep, datap, bits, true);
+    }
+    /// Add a variable of the given width by reference as an output
+    void addOutput(const char* namep, const void* datap, int bits) VL_MT_UNSAFE_ONE {
+        add(namep, const_cast<void*>(datap), bits, false);
+    }
+    /// Set the function called to advance the model each cycle
+    void stepCb(StepCb cb, void* userp) VL_MT_UNSAFE_ONE {
+        m_stepCb = cb;
+        m_stepUserp = userp;
+    }
+
+    // METHODS - serving
+    /// Create the shared memory file, replacing any existing, with rings
+    /// of the given number of entries, rounded up to a power of two.
+    /// User code can check isOpen().
+    void open(const char* filenamep, uint32_t ringEntries = 64) VL_MT_UNSAFE_ONE;
+    /// Unmap and remove the shared memory file
+    void close() VL_MT_UNSAFE_ONE;
+    bool isOpen() const { return m_basep != nullptr; }
+    /// Process requests until the client calls finish() or the model calls
+    /// $finish.  Requests already queued behind that one are answered with
+    /// VL_SHM_FINISH without advancing the model, and further requests are
+    /// refused until serve() is called again.  Also returns, setting
+    /// timedOut(), if the client sends no request or does not free a
+    /// response slot within timeoutMs(), e.g. as it has exited.  Returns
+    /// cycles advanced since open().
+    uint64_t serve() VL_MT_UNSAFE_ONE;
+    /// Cycles advanced since open()
+    uint64_t cycle() const { return m_cycle; }
+    /// Longest time serve() waits for the client, in milliseconds, or 0 to
+    /// wait indefinitely
+    uint32_t timeoutMs() const { return m_timeoutMs; }
+    void timeoutMs(uint32_t ms) { m_timeoutMs = ms; }
+    /// True if the last serve() returned as the client timed out
+    bool timedOut() const { return m_timedOut; }
+};
+
+#endif  // Guard
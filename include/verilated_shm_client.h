@@ -0,0 +1,382 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//=============================================================================
+//
+// Code available from: https://verilator.org
+//
+// Copyright 2026 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//=============================================================================
+///
+/// \file
+/// \brief Verilated shared-memory co-simulation bridge client header
+///
+/// This file is for inclusion by out-of-process testbenches driving a
+/// model served by VerilatedShmServer (see verilated_shm.h).  It needs no
+/// other Verilator sources, so may be built separately from the model.
+///
+/// The shared memory file contains a VerilatedShmHeader, then a
+/// VerilatedShmSignal descriptor per signal, then the signal names, then
+/// a ring of requests from the client and a ring of responses from the
+/// server.  Each ring is a single-producer single-consumer queue; an
+/// entry is published by incrementing its head counter with release
+/// ordering, and freed by incrementing its tail counter.  The client
+/// increments the request head with a compare-and-swap, as the server
+/// sets its VL_SHM_CLOSED bit when it stops accepting requests.
+/// Testbenches in other languages may use the same layout.
+///
+/// A request optionally writes all input values, then advances the model
+/// a number of cycles.  Its response holds the cycle count and all output
+/// values afterwards.  A client may send up to ringEntries requests before
+/// reading their responses, to batch transactions.  Once the server has
+/// finished, requests queued behind the finishing one are answered with
+/// VL_SHM_FINISH without advancing the model.
+///
+//=============================================================================
+
+#ifndef VERILATOR_VERILATED_SHM_CLIENT_H_
+#define VERILATOR_VERILATED_SHM_CLIENT_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+// clang-format off
+#if defined(_WIN32) && !defined(__MINGW32__) && !defined(__CYGWIN__)
+# define VL_SHM_UNSUPPORTED
+#else
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+// clang-format on
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Shared memory counters must be lock free");
+
+//=============================================================================
+// Shared memory layout
+
+enum VerilatedShmConstants : uint32_t {
+    VL_SHM_MAGIC = 0x4d48534c,  // "LSHM"
+    VL_SHM_VERSION = 1,
+    VL_SHM_ALIGN = 64,  // Alignment of rings and entries, a cache line
+};
+
+enum VerilatedShmFlags : uint32_t {
+    VL_SHM_WRITE = 1,  // Request: write the input values before advancing
+    VL_SHM_FINISH = 2,  // Request: server returns after responding
+                        // Response: model called $finish, or server returned
+};
+
+// Bit of m_requestHead set by the server once it accepts no more requests
+static constexpr uint64_t VL_SHM_CLOSED = uint64_t{1} << 63;
+
+struct VerilatedShmHeader final {
+    std::atomic<uint32_t> m_magic;  // VL_SHM_MAGIC, stored last when the server is ready
+    uint32_t m_version;  // VL_SHM_VERSION
+    uint32_t m_signals;  // Number of VerilatedShmSignal following the header
+    uint32_t m_ringEntries;  // Entries in each ring, a power of two
+    uint32_t m_inputBytes;  // Bytes of input values in each request
+    uint32_t m_outputBytes;  // Bytes of output values in each response
+    uint32_t m_requestBytes;  // Bytes between requests
+    uint32_t m_responseBytes;  // Bytes between responses
+    uint64_t m_requestOffset;  // Offset from header to request ring
+    uint64_t m_responseOffset;  // Offset from header to response ring
+    uint64_t m_totalBytes;  // Size of the file
+    alignas(VL_SHM_ALIGN) std::atomic<uint64_t> m_requestHead;  // Requests sent by client
+    alignas(VL_SHM_ALIGN) std::atomic<uint64_t> m_requestTail;  // Requests done by server
+    alignas(VL_SHM_ALIGN) std::atomic<uint64_t> m_responseHead;  // Responses sent by server
+    alignas(VL_SHM_ALIGN) std::atomic<uint64_t> m_responseTail;  // Responses read by client
+};
+
+struct VerilatedShmSignal final {
+    uint32_t m_nameOffset;  // Offset from header to null terminated name
+    uint32_t m_offset;  // Offset of value in request or response values
+    uint32_t m_bits;  // Width
+    uint32_t m_input;  // 1 if in requests, 0 if in responses
+};
+
+struct VerilatedShmRequest final {
+    uint32_t m_cycles;  // Cycles to advance
+    uint32_t m_flags;  // VerilatedShmFlags
+    // Followed by m_inputBytes of input values, at VL_SHM_ALIGN
+};
+
+struct VerilatedShmResponse final {
+    uint64_t m_cycle;  // Cycles advanced since the server started
+    uint64_t m_time;  // VerilatedContext::time()
+    uint32_t m_flags;  // VerilatedShmFlags
+    // Followed by m_outputBytes of output values, at VL_SHM_ALIGN
+};
+
+//=============================================================================
+// VerilatedShmWait
+/// Backoff of a loop waiting for the other end, as used by both the client
+/// and the server.  Spins briefly, then yields, then once the other end has
+/// been idle for a while sleeps between checks, and gives up after a
+/// timeout.
+
+class VerilatedShmWait final {
+    const uint32_t m_timeoutMs;  // Longest wait, 0 for no limit
+    uint32_t m_spins = 0;  // Calls to pause() while spinning
+    std::chrono::steady_clock::time_point m_start;  // When spinning ended
+
+public:
+    explicit VerilatedShmWait(uint32_t timeoutMs)
+        : m_timeoutMs{timeoutMs} {}
+    /// Pause the wait loop, returning false once it has waited timeoutMs
+    bool pause() {
+        if (m_spins < 1000) {
+            ++m_spins;
+            return true;
+        }
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if (m_spins == 1000) {
+            ++m_spins;
+            m_start = now;
+        }
+        if (now - m_start < std::chrono::milliseconds{10}) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds{100});
+        }
+        return !m_timeoutMs || now - m_start < std::chrono::milliseconds{m_timeoutMs};
+    }
+};
+
+//=============================================================================
+// VerilatedShmClient
+/// Client of a VerilatedShmServer, for use by out-of-process testbenches.
+///
+/// Values are in the model's representation, i.e. a CData, SData, IData,
+/// QData or EData words, according to their width.
+///
+/// Waits for the server end after timeoutMs(), or once the server stops
+/// accepting requests, so a client is not left waiting on a server that
+/// has exited.
+///
+/// This class is not thread safe, it must be called by a single thread.
+
+class VerilatedShmClient final {
+    // MEMBERS
+    uint8_t* m_basep = nullptr;  // Mapped file
+    size_t m_bytes = 0;  // Size of mapping
+    std::vector<uint8_t> m_inputs;  // Input values for the next request
+    uint64_t m_sent = 0;  // Requests sent
+    uint64_t m_received = 0;  // Responses received
+    uint32_t m_timeoutMs = 10000;  // Longest wait for the server, 0 for no limit
+
+    VerilatedShmHeader* headerp() const { return reinterpret_cast<VerilatedShmHeader*>(m_basep); }
+    const VerilatedShmSignal* signalsp() const {
+        return reinterpret_cast<const VerilatedShmSignal*>(m_basep + sizeof(VerilatedShmHeader));
+    }
+    bool closed() const {
+        return headerp()->m_requestHead.load(std::memory_order_acquire) & VL_SHM_CLOSED;
+    }
+    static void store(uint8_t* datap, uint32_t bits, uint64_t value) {
+        if (bits <= 8) {
+            const uint8_t v = static_cast<uint8_t>(value);
+            std::memcpy(datap, &v, sizeof(v));
+        } else if (bits <= 16) {
+            const uint16_t v = static_cast<uint16_t>(value);
+            std::memcpy(datap, &v, sizeof(v));
+        } else if (bits <= 32) {
+            const uint32_t v = static_cast<uint32_t>(value);
+            std::memcpy(datap, &v, sizeof(v));
+        } else if (bits <= 64) {
+            std::memcpy(datap, &value, sizeof(value));
+        } else {
+            // EData words, least significant first
+            const uint32_t v[2]
+                = {static_cast<uint32_t>(value), static_cast<uint32_t>(value >> 32)};
+            std::memcpy(datap, v, sizeof(v));
+        }
+    }
+    static uint64_t load(const uint8_t* datap, uint32_t bits) {
+        if (bits <= 8) {
+            uint8_t v;
+            std::memcpy(&v, datap, sizeof(v));
+            return v;
+        } else if (bits <= 16) {
+            uint16_t v;
+            std::memcpy(&v, datap, sizeof(v));
+            return v;
+        } else if (bits <= 32) {
+            uint32_t v;
+            std::memcpy(&v, datap, sizeof(v));
+            return v;
+        } else if (bits <= 64) {
+            uint64_t v;
+            std::memcpy(&v, datap, sizeof(v));
+            return v;
+        }
+        uint32_t v[2];
+        std::memcpy(v, datap, sizeof(v));
+        return (static_cast<uint64_t>(v[1]) << 32) | v[0];
+    }
+
+public:
+    // CONSTRUCTORS
+    VerilatedShmClient() = default;
+    ~VerilatedShmClient() { close(); }
+    VerilatedShmClient(const VerilatedShmClient&) = delete;
+    VerilatedShmClient& operator=(const VerilatedShmClient&) = delete;
+
+    // METHODS
+    /// Map the file created by VerilatedShmServer::open, waiting until the
+    /// server is ready.  Returns false if the file cannot be opened, or the
+    /// server is not ready within timeoutMs().
+    bool open(const char* filenamep) {
+#ifdef VL_SHM_UNSUPPORTED
+        (void)filenamep;
+        return false;
+#else
+        close();
+        const int fd = ::open(filenamep, O_RDWR);
+        if (fd < 0) return false;
+        struct stat st;
+        uint8_t* basep = nullptr;
+        VerilatedShmWait wait{m_timeoutMs};
+        // The server sizes the file before setting the magic number
+        while (::fstat(fd, &st) == 0
+               && static_cast<size_t>(st.st_size) < sizeof(VerilatedShmHeader) && wait.pause()) {}
+        if (static_cast<size_t>(st.st_size) >= sizeof(VerilatedShmHeader)) {
+            void* const mapp
+                = ::mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (mapp != MAP_FAILED) basep = static_cast<uint8_t*>(mapp);
+        }
+        ::close(fd);
+        if (!basep) return false;
+        m_basep = basep;
+        m_bytes = st.st_size;
+        while (headerp()->m_magic.load(std::memory_order_acquire) != VL_SHM_MAGIC) {
+            if (!wait.pause()) {
+                close();
+                return false;
+            }
+        }
+        if (headerp()->m_version != VL_SHM_VERSION || headerp()->m_totalBytes != m_bytes) {
+            close();
+            return false;
+        }
+        m_inputs.assign(headerp()->m_inputBytes, 0);
+        m_sent = headerp()->m_requestHead.load(std::memory_order_acquire) & ~VL_SHM_CLOSED;
+        m_received = headerp()->m_responseTail.load(std::memory_order_acquire);
+        return true;
+#endif
+    }
+    /// Unmap the file
+    void close() {
+#ifndef VL_SHM_UNSUPPORTED
+        if (m_basep) ::munmap(m_basep, m_bytes);
+#endif
+        m_basep = nullptr;
+    }
+    bool isOpen() const { return m_basep != nullptr; }
+    /// Longest time open(), send() and receive() wait for the server, in
+    /// milliseconds, or 0 to wait indefinitely
+    uint32_t timeoutMs() const { return m_timeoutMs; }
+    void timeoutMs(uint32_t ms) { m_timeoutMs = ms; }
+
+    // Signals
+    /// Number of signals
+    size_t signals() const { return headerp()->m_signals; }
+    /// Name of signal number index
+    const char* name(size_t index) const {
+        return reinterpret_cast<const char*>(m_basep + signalsp()[index].m_nameOffset);
+    }
+    /// Width of signal number index
+    uint32_t bits(size_t index) const { return signalsp()[index].m_bits; }
+    /// True if signal number index is an input, in requests
+    bool isInput(size_t index) const { return signalsp()[index].m_input != 0; }
+    /// Byte offset of signal number index in inputs() or a response's values
+    size_t offset(size_t index) const { return signalsp()[index].m_offset; }
+    /// Number of the signal with the given name, or -1 if none
+    int find(const char* namep) const {
+        for (size_t i = 0; i < signals(); ++i) {
+            if (0 == std::strcmp(name(i), namep)) return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+    // Requests
+    /// Input values sent by each send(), retained between requests
+    uint8_t* inputs() { return m_inputs.data(); }
+    /// Set input signal number index to a value of up to 64 bits
+    void input(size_t index, uint64_t value) {
+        store(m_inputs.data() + offset(index), bits(index), value);
+    }
+    /// Requests sent but whose responses have not been received
+    uint64_t outstanding() const { return m_sent - m_received; }
+    /// Send a request to advance the given number of cycles.  Unless flags
+    /// excludes VL_SHM_WRITE, inputs() are written first.  Returns false if
+    /// ringEntries requests are outstanding, so receive() must be called, or
+    /// if the server has stopped accepting requests or timed out.
+    bool send(uint32_t cycles, uint32_t flags = VL_SHM_WRITE) {
+        VerilatedShmHeader* const hp = headerp();
+        if (outstanding() >= hp->m_ringEntries) return false;
+        VerilatedShmWait wait{m_timeoutMs};
+        while (m_sent - hp->m_requestTail.load(std::memory_order_acquire) >= hp->m_ringEntries) {
+            if (closed() || !wait.pause()) return false;
+        }
+        uint8_t* const entryp = m_basep + hp->m_requestOffset
+                                + (m_sent & (hp->m_ringEntries - 1)) * hp->m_requestBytes;
+        VerilatedShmRequest* const reqp = reinterpret_cast<VerilatedShmRequest*>(entryp);
+        reqp->m_cycles = cycles;
+        reqp->m_flags = flags;
+        if (flags & VL_SHM_WRITE) {
+            std::memcpy(entryp + VL_SHM_ALIGN, m_inputs.data(), m_inputs.size());
+        }
+        // Fails if the server has set VL_SHM_CLOSED
+        uint64_t expected = m_sent;
+        if (!hp->m_requestHead.compare_exchange_strong(expected, m_sent + 1,
+                                                       std::memory_order_acq_rel)) {
+            return false;
+        }
+        ++m_sent;
+        return true;
+    }
+    /// Ask the server to return from serve(), after any outstanding requests
+    bool finish() { return send(0, VL_SHM_FINISH); }
+
+    // Responses
+    /// Wait for the response to the oldest outstanding request, returning
+    /// it.  Its values follow it at VL_SHM_ALIGN.  The response remains
+    /// valid until release().  Returns nullptr if the server has closed
+    /// without responding, or did not respond within timeoutMs().
+    const VerilatedShmResponse* receive() {
+        VerilatedShmHeader* const hp = headerp();
+        VerilatedShmWait wait{m_timeoutMs};
+        while (hp->m_responseHead.load(std::memory_order_acquire) == m_received) {
+            // The server publishes all of its responses before closing
+            if (closed()) {
+                if (hp->m_responseHead.load(std::memory_order_acquire) != m_received) break;
+                return nullptr;
+            }
+            if (!wait.pause()) return nullptr;
+        }
+        return reinterpret_cast<const VerilatedShmResponse*>(
+            m_basep + hp->m_responseOffset
+            + (m_received & (hp->m_ringEntries - 1)) * hp->m_responseBytes);
+    }
+    /// Output values of a response from receive()
+    static const uint8_t* values(const VerilatedShmResponse* rspp) {
+        return reinterpret_cast<const uint8_t*>(rspp) + VL_SHM_ALIGN;
+    }
+    /// Output signal number index of a response from receive(), of up to 64 bits
+    uint64_t output(const VerilatedShmResponse* rspp, size_t index) const {
+        return load(values(rspp) + offset(index), bits(index));
+    }
+    /// Free the response from receive(), for reuse by the server
+    void release() { headerp()->m_responseTail.store(++m_received, std::memory_order_release); }
+};
+
+#endif  // Guard
@@ -255,6 +255,7 @@ class VerilatedVar final : public VerilatedVarProps {
     // MEMBERS
     void* const m_datap;  // Location of data
     const char* const m_namep;  // Name - slowpath
+    uint8_t* m_dirtyp = nullptr;  // If non-null, flag set by model when may have changed
 protected:
     const bool m_isParam;
     friend class VerilatedScope;
@@ -272,6 +273,8 @@ public:
     void* datap() const { return m_datap; }
     const char* name() const { return m_namep; }
     bool isParam() const { return m_isParam; }
+    // Flag set on every write to variable, from --vpi-change-hooks, else nullptr
+    uint8_t* dirtyp() const { return m_dirtyp; }
 };
 
 #endif  // Guard
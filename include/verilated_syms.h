@@ -46,6 +46,18 @@ struct VerilatedCStrCmp final {
     bool operator()(const char* a, const char* b) const { return std::strcmp(a, b) < 0; }
 };
 
+// Class to hash unordered maps keyed by const char*'s, without making a std::string
+struct VerilatedCStrHash final {
+    size_t operator()(const char* a) const {
+        uint64_t hash = 0xcbf29ce484222325ULL;  // FNV-1a
+        while (*a) hash = (hash ^ static_cast<uint8_t>(*a++)) * 0x100000001b3ULL;
+        return static_cast<size_t>(hash);
+    }
+};
+struct VerilatedCStrEq final {
+    bool operator()(const char* a, const char* b) const { return std::strcmp(a, b) == 0; }
+};
+
 // Map of sorted scope names to find associated scope class
 // This is a class instead of typedef/using to allow forward declaration in verilated.h
 class VerilatedScopeNameMap final
@@ -55,6 +67,10 @@ public:
     ~VerilatedScopeNameMap() = default;
 };
 
+// Map of hashed scope names to find associated scope class, for scopeFind
+using VerilatedScopeHashMap
+    = std::unordered_map<const char*, const VerilatedScope*, VerilatedCStrHash, VerilatedCStrEq>;
+
 // Map of sorted variable names to find associated variable class
 // This is a class instead of typedef/using to allow forward declaration in verilated.h
 class VerilatedVarNameMap final : public std::map<const char*, VerilatedVar, VerilatedCStrCmp> {
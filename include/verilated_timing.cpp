@@ -22,6 +22,10 @@
 
 #include "verilated_timing.h"
 
+#include "verilated_threads.h"
+
+#include <algorithm>
+
 //======================================================================
 // VlCoroutineHandle:: Methods
 
@@ -50,21 +54,366 @@ void VlCoroutineHandle::dump() const {
 }
 #endif
 
+//======================================================================
+// VlCoroutineFramePool:: Methods
+
+// Pools of all threads, and statistics of exited threads
+class VlCoroutineFramePoolRegistry final {
+public:
+    VerilatedMutex m_mutex;
+    std::set<const VlCoroutineFramePool*> m_pools VL_GUARDED_BY(m_mutex);  // Pools of threads
+    uint64_t m_exitedAllocs VL_GUARDED_BY(m_mutex) = 0;  // Frames allocated by exited threads
+    uint64_t m_exitedReuses VL_GUARDED_BY(m_mutex) = 0;  // Frames reused by exited threads
+    int64_t m_exitedLive VL_GUARDED_BY(m_mutex) = 0;  // Live frames of exited threads
+    std::atomic<uint64_t> m_systemBytes{0};  // Bytes of frames allocated with operator new
+    std::atomic<uint64_t> m_peakBytes{0};  // Maximum of m_systemBytes
+
+    static VlCoroutineFramePoolRegistry& singleton() VL_MT_SAFE {
+        static VlCoroutineFramePoolRegistry s_registry;
+        return s_registry;
+    }
+    void addSystemBytes(uint64_t bytes) VL_MT_SAFE {
+        const uint64_t total = m_systemBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        uint64_t peak = m_peakBytes.load(std::memory_order_relaxed);
+        while (total > peak
+               && !m_peakBytes.compare_exchange_weak(peak, total, std::memory_order_relaxed)) {}
+    }
+    void subSystemBytes(uint64_t bytes) VL_MT_SAFE {
+        m_systemBytes.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+};
+
+VlCoroutineFramePool::VlCoroutineFramePool() {
+    VlCoroutineFramePoolRegistry& registry = VlCoroutineFramePoolRegistry::singleton();
+    const VerilatedLockGuard lock{registry.m_mutex};
+    registry.m_pools.insert(this);
+}
+
+VlCoroutineFramePool::~VlCoroutineFramePool() {
+    // Frames still in use by other threads were allocated individually, so remain valid
+    uint64_t freedBytes = 0;
+    for (size_t sizeClass = 0; sizeClass < CLASSES; ++sizeClass) {
+        while (FreeFrame* const framep = m_freeps[sizeClass]) {
+            m_freeps[sizeClass] = framep->m_nextp;
+            ::operator delete(framep);
+            freedBytes += (sizeClass + 1) * GRANULE;
+        }
+    }
+    VlCoroutineFramePoolRegistry& registry = VlCoroutineFramePoolRegistry::singleton();
+    registry.subSystemBytes(freedBytes);
+    const VerilatedLockGuard lock{registry.m_mutex};
+    registry.m_pools.erase(this);
+    registry.m_exitedAllocs += m_allocs.load(std::memory_order_relaxed);
+    registry.m_exitedReuses += m_reuses.load(std::memory_order_relaxed);
+    registry.m_exitedLive += m_live.load(std::memory_order_relaxed);
+    s_threadExited = true;
+}
+
+void* VlCoroutineFramePool::allocateSlow(VlCoroutineFramePool* poolp, size_t size) VL_MT_SAFE {
+    // Pooled frames are allocated with their size class's size, so any frame of a class can be
+    // reused for any size of that class
+    const size_t sizeClass = (size - 1) / GRANULE;
+    const size_t bytes = sizeClass < CLASSES ? (sizeClass + 1) * GRANULE : size;
+    if (poolp) {
+        count(poolp->m_allocs);
+        poolp->addLive(1);
+    }
+    VlCoroutineFramePoolRegistry::singleton().addSystemBytes(bytes);
+    return ::operator new(bytes);
+}
+
+void VlCoroutineFramePool::deallocateSlow(VlCoroutineFramePool* poolp, void* ptr,
+                                          size_t size) VL_MT_SAFE {
+    const size_t sizeClass = (size - 1) / GRANULE;
+    const size_t bytes = sizeClass < CLASSES ? (sizeClass + 1) * GRANULE : size;
+    if (poolp) poolp->addLive(-1);
+    VlCoroutineFramePoolRegistry::singleton().subSystemBytes(bytes);
+    ::operator delete(ptr);
+}
+
+void VlCoroutineFramePool::statsPrint() VL_MT_SAFE {
+    VlCoroutineFramePoolRegistry& registry = VlCoroutineFramePoolRegistry::singleton();
+    uint64_t allocs;
+    uint64_t reuses;
+    int64_t live;
+    {
+        const VerilatedLockGuard lock{registry.m_mutex};
+        allocs = registry.m_exitedAllocs;
+        reuses = registry.m_exitedReuses;
+        live = registry.m_exitedLive;
+        for (const VlCoroutineFramePool* const poolp : registry.m_pools) {
+            allocs += poolp->m_allocs.load(std::memory_order_relaxed);
+            reuses += poolp->m_reuses.load(std::memory_order_relaxed);
+            live += poolp->m_live.load(std::memory_order_relaxed);
+        }
+    }
+    const double systemKB = registry.m_systemBytes.load(std::memory_order_relaxed) / 1024.0;
+    const double peakKB = registry.m_peakBytes.load(std::memory_order_relaxed) / 1024.0;
+    VL_PRINTF_MT("- Verilator: coroutine frames %" PRIu64 " allocated, %" PRIu64
+                 " reused, %" PRId64 " live; frame memory %0.1f KB, peak %0.1f KB\n",
+                 allocs, reuses, live, systemKB, peakKB);
+}
+
 //======================================================================
 // VlDelayScheduler:: Methods
 
+// Suspension made during parallel resumption, added once the workers are done
+struct VlDelayStaged final {
+    uint64_t m_time;  // Simulation time to resume
+    VlCoroutineHandle m_handle;  // Coroutine to resume
+    bool m_parallel;  // Suspended with delayParallel()
+    bool m_zeroDelayed;  // Suspended on #0
+};
+
+// Share of a parallel resumption executed by one thread
+struct VlDelayChunk final {
+    VlCoroutineHandle* m_beginp = nullptr;  // First coroutine to resume
+    VlCoroutineHandle* m_endp = nullptr;  // One past the last coroutine to resume
+    std::vector<VlDelayStaged> m_staged;  // Suspensions, in order made
+    std::atomic<bool> m_done{false};  // Set when all resumed
+};
+
+// Suspensions of the chunk being resumed by this thread
+static thread_local std::vector<VlDelayStaged>* t_vlDelayStagedp = nullptr;
+
+void VlDelayScheduler::push(uint64_t time, VlCoroutineHandle&& handle, bool parallel) {
+    if (VL_UNLIKELY(m_staging)) {
+        stage(time, std::move(handle), parallel, false);
+        return;
+    }
+    uint32_t index;
+    if (m_freeNode != NO_NODE) {
+        index = m_freeNode;
+        Node& node = m_nodes[index];
+        m_freeNode = node.m_next;
+        node.m_time = time;
+        node.m_handle = std::move(handle);
+        node.m_parallel = parallel;
+    } else {
+        index = static_cast<uint32_t>(m_nodes.size());
+        m_nodes.emplace_back(time, std::move(handle), parallel);
+    }
+    ++m_size;
+    insert(index);
+}
+
+void VlDelayScheduler::pushZeroDelayed(VlCoroutineHandle&& handle) {
+    if (VL_UNLIKELY(m_staging)) {
+        stage(m_context.time(), std::move(handle), false, true);
+        return;
+    }
+    m_zeroDelayed.emplace_back(std::move(handle));
+}
+
+void VlDelayScheduler::stage(uint64_t time, VlCoroutineHandle&& handle, bool parallel,
+                             bool zeroDelayed) {
+    t_vlDelayStagedp->push_back(VlDelayStaged{time, std::move(handle), parallel, zeroDelayed});
+}
+
+void VlDelayScheduler::resumeChunk(void* chunkp, bool) {
+    VlDelayChunk* const cp = static_cast<VlDelayChunk*>(chunkp);
+    t_vlDelayStagedp = &cp->m_staged;
+    for (VlCoroutineHandle* handlep = cp->m_beginp; handlep != cp->m_endp; ++handlep) {
+        handlep->resume();
+    }
+    t_vlDelayStagedp = nullptr;
+    cp->m_done.store(true, std::memory_order_release);
+}
+
+void VlDelayScheduler::resumeParallel() {
+    // Fewest coroutines worth handing to another thread
+    static constexpr size_t MIN_CHUNK = 8;
+    if (VL_UNLIKELY(!m_threadPoolInit)) {
+        m_threadPoolInit = true;
+        m_threadPoolp = static_cast<VlThreadPool*>(m_context.threadPoolp());
+    }
+    const size_t count = m_parallelResumed.size();
+    const size_t workers = m_threadPoolp ? m_threadPoolp->numThreads() : 0;
+    const size_t nchunks = std::min(workers + 1, count / MIN_CHUNK);
+    if (nchunks < 2) {
+        for (VlCoroutineHandle& handle : m_parallelResumed) handle.resume();
+        m_parallelResumed.clear();
+        return;
+    }
+    // Contiguous chunks, so staged suspensions concatenate in serial resumption order
+    std::vector<VlDelayChunk> chunks(nchunks);
+    for (size_t i = 0; i < nchunks; ++i) {
+        chunks[i].m_beginp = m_parallelResumed.data() + count * i / nchunks;
+        chunks[i].m_endp = m_parallelResumed.data() + count * (i + 1) / nchunks;
+    }
+    m_staging = true;
+    for (size_t i = 1; i < nchunks; ++i) {
+        m_threadPoolp->workerp(static_cast<int>(i - 1))->addTask(&resumeChunk, &chunks[i]);
+    }
+    resumeChunk(&chunks[0], false);
+    for (size_t i = 1; i < nchunks; ++i) {
+        unsigned spins = 0;
+        while (!chunks[i].m_done.load(std::memory_order_acquire)) {
+            if (++spins < VL_LOCK_SPINS) {
+                VL_CPU_RELAX();
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+    m_staging = false;
+    for (VlDelayChunk& chunk : chunks) {
+        for (VlDelayStaged& staged : chunk.m_staged) {
+            if (staged.m_zeroDelayed) {
+                m_zeroDelayed.emplace_back(std::move(staged.m_handle));
+            } else {
+                push(staged.m_time, std::move(staged.m_handle), staged.m_parallel);
+            }
+        }
+    }
+    m_parallelResumed.clear();
+}
+
+void VlDelayScheduler::insert(uint32_t index) {
+    const uint64_t time = m_nodes[index].m_time;
+    if (VL_UNLIKELY(time < m_wheelTime)) {
+        append(m_past, index);
+        return;
+    }
+    const uint64_t diff = time ^ m_wheelTime;
+    const int level = diff ? VL_MOSTSETBIT_Q(diff) / WHEEL_BITS : 0;
+    const int slot = static_cast<int>((time >> (level * WHEEL_BITS)) & (WHEEL_SLOTS - 1));
+    m_occupied[level] |= 1ULL << slot;
+    append(m_buckets[level][slot], index);
+}
+
+void VlDelayScheduler::append(Bucket& bucket, uint32_t index) {
+    Node& node = m_nodes[index];
+    node.m_next = NO_NODE;
+    if (bucket.empty()) {
+        bucket.m_head = index;
+    } else {
+        m_nodes[bucket.m_tail].m_next = index;
+    }
+    bucket.m_tail = index;
+    if (node.m_time < bucket.m_minTime) bucket.m_minTime = node.m_time;
+}
+
+VlCoroutineHandle VlDelayScheduler::release(uint32_t index) {
+    Node& node = m_nodes[index];
+    VlCoroutineHandle handle{std::move(node.m_handle)};
+    node.m_next = m_freeNode;
+    m_freeNode = index;
+    --m_size;
+    return handle;
+}
+
+void VlDelayScheduler::advance(uint64_t time) {
+    if (time <= m_wheelTime) return;
+    // Levels below the most significant changed digit, and earlier buckets of that level, hold
+    // times before the new time. They were missed, so are kept in the past bucket.
+    const int top = VL_MOSTSETBIT_Q(time ^ m_wheelTime) / WHEEL_BITS;
+    const int topSlot = static_cast<int>((time >> (top * WHEEL_BITS)) & (WHEEL_SLOTS - 1));
+    const auto spliceLevel = [this](int level, uint64_t slots) {
+        for (uint64_t bits = m_occupied[level] & slots; bits; bits &= bits - 1) {
+            Bucket& bucket = m_buckets[level][VL_LEASTSETBIT_Q(bits)];
+            if (m_past.empty()) {
+                m_past.m_head = bucket.m_head;
+            } else {
+                m_nodes[m_past.m_tail].m_next = bucket.m_head;
+            }
+            m_past.m_tail = bucket.m_tail;
+            if (bucket.m_minTime < m_past.m_minTime) m_past.m_minTime = bucket.m_minTime;
+            bucket = Bucket{};
+        }
+        m_occupied[level] &= ~slots;
+    };
+    for (int level = 0; level < top; ++level) spliceLevel(level, ~0ULL);
+    spliceLevel(top, (1ULL << topSlot) - 1);
+    // The bucket of the new time's digit is redistributed into lower levels
+    Bucket bucket = m_buckets[top][topSlot];
+    m_buckets[top][topSlot] = Bucket{};
+    m_occupied[top] &= ~(1ULL << topSlot);
+    m_wheelTime = time;
+    for (uint32_t index = bucket.m_head; index != NO_NODE;) {
+        const uint32_t next = m_nodes[index].m_next;
+        insert(index);
+        index = next;
+    }
+}
+
+uint64_t VlDelayScheduler::wheelMinTime() const {
+    // Times of lower levels are all before those of higher levels
+    for (int level = 0; level < WHEEL_LEVELS; ++level) {
+        if (m_occupied[level]) {
+            return m_buckets[level][VL_LEASTSETBIT_Q(m_occupied[level])].m_minTime;
+        }
+    }
+    return ~0ULL;
+}
+
+void VlDelayScheduler::toggle(CData& var, uint64_t period) {
+    const uint64_t time = m_context.time() + period;
+    m_toggles.push_back(Toggle{time, period, &var});
+    m_toggleMinTime = std::min(m_toggleMinTime, time);
+}
+
+bool VlDelayScheduler::resumeToggles(uint64_t time) {
+    if (m_toggleMinTime > time) return false;
+    // Each period is computed directly, there are no coroutines to resume
+    m_toggleMinTime = ~0ULL;
+    for (Toggle& toggle : m_toggles) {
+        if (toggle.m_time <= time) {
+            *toggle.m_varp ^= 1;
+            toggle.m_time = time + toggle.m_period;
+        }
+        m_toggleMinTime = std::min(m_toggleMinTime, toggle.m_time);
+    }
+    return true;
+}
+
 void VlDelayScheduler::resume() {
 #ifdef VL_DEBUG
     VL_DEBUG_IF(dump(); VL_DBG_MSGF("         Resuming delayed processes\n"););
 #endif
     bool resumed = false;
+    const uint64_t time = m_context.time();
 
-    while (!m_queue.empty() && (m_queue.cbegin()->first == m_context.time())) {
-        VlCoroutineHandle handle = std::move(m_queue.begin()->second);
-        m_queue.erase(m_queue.begin());
-        handle.resume();
+    advance(time);
+    if (VL_UNLIKELY(m_past.m_minTime <= time)) {
+        // Time was moved backwards, or these were missed
+        std::vector<VlCoroutineHandle> handles;
+        const uint32_t head = m_past.m_head;
+        m_past = Bucket{};
+        for (uint32_t index = head; index != NO_NODE;) {
+            const uint32_t next = m_nodes[index].m_next;
+            if (m_nodes[index].m_time == time) {
+                handles.emplace_back(release(index));
+            } else {
+                append(m_past, index);
+            }
+            index = next;
+        }
+        for (VlCoroutineHandle& handle : handles) handle.resume();
+        resumed = !handles.empty();
+    }
+    const int slot = static_cast<int>(time & (WHEEL_SLOTS - 1));
+    // If time was moved backwards, the wheel was not advanced, and its slot is a later time
+    if (time == m_wheelTime && (m_occupied[0] & (1ULL << slot))) {
+        // Detach the bucket first, as resumed coroutines may suspend again, reusing its nodes
+        const uint32_t head = m_buckets[0][slot].m_head;
+        m_buckets[0][slot] = Bucket{};
+        m_occupied[0] &= ~(1ULL << slot);
+        for (uint32_t index = head; index != NO_NODE;) {
+            const uint32_t next = m_nodes[index].m_next;
+            if (m_nodes[index].m_parallel) {
+                m_parallelResumed.emplace_back(release(index));
+            } else {
+                release(index).resume();
+            }
+            index = next;
+        }
+        // After the others, as these are only independent of each other
+        if (!m_parallelResumed.empty()) resumeParallel();
         resumed = true;
     }
+    // After coroutines, as these typically suspended before the toggle's previous inversion
+    if (resumeToggles(time)) resumed = true;
 
     if (!m_zeroDelayed.empty()) {
         // First, we need to move the coroutines out of the queue, as a resumed coroutine can
@@ -92,7 +441,9 @@ void VlDelayScheduler::resume() {
 }
 
 uint64_t VlDelayScheduler::nextTimeSlot() const {
-    if (!m_queue.empty()) return m_queue.cbegin()->first;
+    if (m_size || !m_toggles.empty()) {
+        return std::min({wheelMinTime(), m_past.m_minTime, m_toggleMinTime});
+    }
     if (m_zeroDelayed.empty())
         VL_FATAL_MT(__FILE__, __LINE__, "", "There is no next time slot scheduled");
     return m_context.time();
@@ -100,7 +451,11 @@ uint64_t VlDelayScheduler::nextTimeSlot() const {
 
 #ifdef VL_DEBUG
 void VlDelayScheduler::dump() const {
-    if (m_queue.empty()) {
+    for (const Toggle& toggle : m_toggles) {
+        VL_DBG_MSGF("         Toggling every %" PRIu64 ", next at time %" PRIu64 "\n",
+                    toggle.m_period, toggle.m_time);
+    }
+    if (!m_size) {
         VL_DBG_MSGF("         No delayed processes:\n");
     } else {
         VL_DBG_MSGF("         Delayed processes:\n");
@@ -110,9 +465,21 @@ void VlDelayScheduler::dump() const {
                         m_context.time());
             susp.dump();
         }
-        for (const auto& susp : m_queue) {
-            VL_DBG_MSGF("             Awaiting time %" PRIu64 ": ", susp.first);
-            susp.second.dump();
+        // Buckets of higher levels are not sorted, so sort by time, keeping order suspended
+        std::vector<const Node*> nodeps;
+        const auto addBucket = [&](const Bucket& bucket) {
+            for (uint32_t index = bucket.m_head; index != NO_NODE; index = m_nodes[index].m_next)
+                nodeps.push_back(&m_nodes[index]);
+        };
+        addBucket(m_past);
+        for (int level = 0; level < WHEEL_LEVELS; ++level) {
+            for (int slot = 0; slot < WHEEL_SLOTS; ++slot) addBucket(m_buckets[level][slot]);
+        }
+        std::stable_sort(nodeps.begin(), nodeps.end(),
+                         [](const Node* ap, const Node* bp) { return ap->m_time < bp->m_time; });
+        for (const Node* const nodep : nodeps) {
+            VL_DBG_MSGF("             Awaiting time %" PRIu64 ": ", nodep->m_time);
+            nodep->m_handle.dump();
         }
     }
 }
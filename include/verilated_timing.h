@@ -159,19 +159,93 @@ enum class VlDelayPhase : bool { ACTIVE, INACTIVE };
 //=============================================================================
 // VlDelayScheduler stores coroutines to be resumed at a certain simulation time. If the current
 // time is equal to a coroutine's resume time, the coroutine gets resumed.
+//
+// Delayed coroutines are kept in a hierarchical timing wheel. Each level has 64 buckets, and
+// a coroutine is placed in the level of the most significant 6-bit digit in which its time
+// differs from the wheel's time. So level 0 buckets hold a single time each, and as the wheel
+// advances, buckets of higher levels are redistributed into lower levels. Coroutines at equal
+// times are resumed in the order they were suspended. Nodes are pooled and reused.
+//
+// Coroutines of processes that V3Timing proved independent of each other suspend with
+// delayParallel(). At each time, these are resumed after the other coroutines, split over the
+// context's VlThreadPool workers. Their suspensions are staged per worker, then added in the
+// order a serial resumption would have added them.
+
+class VlThreadPool;
 
 class VlDelayScheduler final {
     // TYPES
-    // Time-sorted queue of timestamps and handles
-    using VlDelayedCoroutineQueue = std::multimap<uint64_t, VlCoroutineHandle>;
+    static constexpr uint32_t NO_NODE = ~0U;  // Null node index
+    static constexpr int WHEEL_BITS = 6;  // Bits of time per level
+    static constexpr int WHEEL_SLOTS = 1 << WHEEL_BITS;  // Buckets per level
+    static constexpr int WHEEL_LEVELS = (64 + WHEEL_BITS - 1) / WHEEL_BITS;  // Levels
+
+    // Suspended coroutine, linked into a bucket, or into the free list
+    struct Node final {
+        uint64_t m_time;  // Simulation time to resume
+        VlCoroutineHandle m_handle;  // Coroutine to resume
+        uint32_t m_next;  // Next node index, or NO_NODE
+        bool m_parallel;  // May be resumed in parallel with other such nodes
+
+        Node(uint64_t time, VlCoroutineHandle&& handle, bool parallel)
+            : m_time{time}
+            , m_handle{std::move(handle)}
+            , m_next{NO_NODE}
+            , m_parallel{parallel} {}
+    };
+    // First-in first-out list of nodes
+    struct Bucket final {
+        uint32_t m_head = NO_NODE;  // First node index
+        uint32_t m_tail = NO_NODE;  // Last node index
+        uint64_t m_minTime = ~0ULL;  // Earliest time of any node
+        bool empty() const { return m_head == NO_NODE; }
+    };
+    // Variable inverted periodically, replacing a free-running clock generator process
+    struct Toggle final {
+        uint64_t m_time;  // Simulation time of next inversion
+        uint64_t m_period;  // Time between inversions
+        CData* m_varp;  // Variable to invert
+    };
 
     // MEMBERS
     VerilatedContext& m_context;
-    VlDelayedCoroutineQueue m_queue;  // Coroutines to be restored at a certain simulation time
+    std::vector<Node> m_nodes;  // Pool of nodes of all buckets
+    uint32_t m_freeNode = NO_NODE;  // Free list of m_nodes
+    size_t m_size = 0;  // Number of coroutines in buckets
+    uint64_t m_wheelTime = 0;  // Time the wheel levels are relative to
+    uint64_t m_occupied[WHEEL_LEVELS] = {};  // Bit set for each non-empty bucket
+    Bucket m_buckets[WHEEL_LEVELS][WHEEL_SLOTS];  // Buckets of each level
+    Bucket m_past;  // Coroutines at times before m_wheelTime, e.g. if time was moved backwards
     std::vector<VlCoroutineHandle> m_zeroDelayed;  // Coroutines waiting for #0
     std::vector<VlCoroutineHandle> m_zeroDlyResumed;  // Coroutines that waited for #0 and are
                                                       // to be resumed. Kept as a field to avoid
                                                       // reallocation.
+    std::vector<Toggle> m_toggles;  // Variables inverted periodically
+    uint64_t m_toggleMinTime = ~0ULL;  // Earliest time of any toggle
+    std::vector<VlCoroutineHandle> m_parallelResumed;  // Coroutines to resume in parallel
+    VlThreadPool* m_threadPoolp = nullptr;  // Workers for parallel resumption
+    bool m_threadPoolInit = false;  // m_threadPoolp was looked up
+    bool m_staging = false;  // Resuming in parallel, so stage suspensions
+
+    // METHODS
+    // Invert variables due at the given time, returns true if any were
+    bool resumeToggles(uint64_t time);
+    // Resume m_parallelResumed, split over the thread pool workers
+    void resumeParallel();
+    // Worker function resuming a share of m_parallelResumed
+    static void resumeChunk(void* chunkp, bool);
+    // Record a suspension made during parallel resumption
+    void stage(uint64_t time, VlCoroutineHandle&& handle, bool parallel, bool zeroDelayed);
+    // Add a node to the wheel, or the past bucket
+    void insert(uint32_t index);
+    // Append a node to a bucket
+    void append(Bucket& bucket, uint32_t index);
+    // Move the wheel to the given time, redistributing buckets of higher levels
+    void advance(uint64_t time);
+    // Return a node to the free list, moving its coroutine out
+    VlCoroutineHandle release(uint32_t index);
+    // Earliest time in the wheel, excluding the past bucket
+    uint64_t wheelMinTime() const;
 
 public:
     // CONSTRUCTORS
@@ -183,33 +257,44 @@ public:
     // Returns the simulation time of the next time slot (aborts if there are no delayed
     // coroutines)
     uint64_t nextTimeSlot() const;
-    // Are there no delayed coroutines awaiting?
-    bool empty() const { return m_queue.empty() && m_zeroDelayed.empty(); }
-    // Are there coroutines to resume at the current simulation time?
+    // Are there no delayed coroutines or toggles awaiting?
+    bool empty() const { return !m_size && m_zeroDelayed.empty() && m_toggles.empty(); }
+    // Are there coroutines to resume, or toggles due, at the current simulation time?
     bool awaitingCurrentTime() const {
-        return (!m_queue.empty() && (m_queue.cbegin()->first <= m_context.time()))
-               || !m_zeroDelayed.empty();
+        return (m_size
+                && (wheelMinTime() <= m_context.time()
+                    || m_past.m_minTime <= m_context.time()))
+               || !m_zeroDelayed.empty() || m_toggleMinTime <= m_context.time();
     }
 #ifdef VL_DEBUG
     void dump() const;
 #endif
-    // Used by coroutines for co_awaiting a certain simulation time
-    auto delay(uint64_t delay, VlProcessRef process, const char* filename = VL_UNKNOWN,
-               int lineno = 0) {
+    // Add a coroutine to be resumed at the given simulation time
+    void push(uint64_t time, VlCoroutineHandle&& handle, bool parallel = false);
+    // Add a coroutine to be resumed in the inactive region
+    void pushZeroDelayed(VlCoroutineHandle&& handle);
+    // Invert the given variable every 'period' from now on, as a coroutine of
+    // 'always #period var = ~var' would
+    void toggle(CData& var, uint64_t period);
+
+private:
+    // Awaitable suspending the calling coroutine until the given delay
+    auto awaitable(uint64_t delay, VlProcessRef process, bool parallel, const char* filename,
+                   int lineno) {
         struct Awaitable final {
             VlProcessRef process;  // Data of the suspended process, null if not needed
-            VlDelayedCoroutineQueue& queue;
-            std::vector<VlCoroutineHandle>& queueZeroDelay;
+            VlDelayScheduler& scheduler;
             const uint64_t delay;
             const VlDelayPhase phase;
+            const bool parallel;  // May be resumed in parallel
             const VlFileLineDebug fileline;
 
             bool await_ready() const { return false; }  // Always suspend
             void await_suspend(std::coroutine_handle<> coro) {
                 if (phase == VlDelayPhase::ACTIVE) {
-                    queue.emplace(delay, VlCoroutineHandle{coro, process, fileline});
+                    scheduler.push(delay, VlCoroutineHandle{coro, process, fileline}, parallel);
                 } else {
-                    queueZeroDelay.emplace_back(VlCoroutineHandle{coro, process, fileline});
+                    scheduler.pushZeroDelayed(VlCoroutineHandle{coro, process, fileline});
                 }
             }
             void await_resume() const {}
@@ -224,9 +309,20 @@ public:
         }
 #endif
 
-        return Awaitable{process,       m_queue,
-                         m_zeroDelayed, m_context.time() + delay,
-                         phase,         VlFileLineDebug{filename, lineno}};
+        return Awaitable{process, *this, m_context.time() + delay, phase, parallel,
+                         VlFileLineDebug{filename, lineno}};
+    }
+
+public:
+    // Used by coroutines for co_awaiting a certain simulation time
+    auto delay(uint64_t delay, VlProcessRef process, const char* filename = VL_UNKNOWN,
+               int lineno = 0) {
+        return awaitable(delay, process, false, filename, lineno);
+    }
+    // As delay(), for processes independent of all others suspending with delayParallel()
+    auto delayParallel(uint64_t delay, VlProcessRef process, const char* filename = VL_UNKNOWN,
+                       int lineno = 0) {
+        return awaitable(delay, process, true, filename, lineno);
     }
 };
 
@@ -415,6 +511,86 @@ public:
     }
 };
 
+//=============================================================================
+// VlCoroutineFramePool allocates coroutine frames from free lists of size classes, so that
+// frequently called tasks with timing controls reuse frames instead of calling operator new.
+// Each thread has its own pool, so coroutines running in parallel do not contend. A frame freed
+// by another thread than the one that allocated it joins the freeing thread's pool.
+
+class VlCoroutineFramePool final {
+    // CONSTANTS
+    static constexpr size_t GRANULE = 64;  // Frame sizes are rounded up to a multiple of this
+    static constexpr size_t CLASSES = 64;  // Frames up to GRANULE * CLASSES bytes are pooled
+
+    // TYPES
+    struct FreeFrame final {
+        FreeFrame* m_nextp;  // Next free frame of the same size class
+    };
+
+    // MEMBERS
+    FreeFrame* m_freeps[CLASSES] = {};  // Free list of each size class
+    // Statistics, only written by the owning thread, read by statsPrint()
+    std::atomic<uint64_t> m_allocs{0};  // Frames allocated
+    std::atomic<uint64_t> m_reuses{0};  // Frames allocated from a free list
+    std::atomic<int64_t> m_live{0};  // Frames allocated minus frames freed by this thread
+
+    static inline thread_local bool s_threadExited = false;  // Thread's pool was destroyed
+
+    // METHODS
+    // Pool of the current thread, or nullptr if the thread is exiting
+    static VlCoroutineFramePool* threadPoolp() VL_MT_SAFE {
+        if (VL_UNLIKELY(s_threadExited)) return nullptr;
+        static thread_local VlCoroutineFramePool t_pool;
+        return &t_pool;
+    }
+    static void count(std::atomic<uint64_t>& counter) {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+    void addLive(int64_t delta) {
+        m_live.store(m_live.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+    static void* allocateSlow(VlCoroutineFramePool* poolp, size_t size) VL_MT_SAFE;
+    static void deallocateSlow(VlCoroutineFramePool* poolp, void* ptr, size_t size) VL_MT_SAFE;
+
+public:
+    // CONSTRUCTORS
+    VlCoroutineFramePool();
+    ~VlCoroutineFramePool();
+    VL_UNCOPYABLE(VlCoroutineFramePool);
+
+    // METHODS
+    // Allocate a frame of the given size
+    static void* allocate(size_t size) VL_MT_SAFE {
+        VlCoroutineFramePool* const poolp = threadPoolp();
+        const size_t sizeClass = (size - 1) / GRANULE;
+        if (VL_LIKELY(poolp && sizeClass < CLASSES)) {
+            if (FreeFrame* const framep = poolp->m_freeps[sizeClass]) {
+                poolp->m_freeps[sizeClass] = framep->m_nextp;
+                count(poolp->m_allocs);
+                count(poolp->m_reuses);
+                poolp->addLive(1);
+                return framep;
+            }
+        }
+        return allocateSlow(poolp, size);
+    }
+    // Free a frame of the given size
+    static void deallocate(void* ptr, size_t size) VL_MT_SAFE {
+        VlCoroutineFramePool* const poolp = threadPoolp();
+        const size_t sizeClass = (size - 1) / GRANULE;
+        if (VL_LIKELY(poolp && sizeClass < CLASSES)) {
+            FreeFrame* const framep = static_cast<FreeFrame*>(ptr);
+            framep->m_nextp = poolp->m_freeps[sizeClass];
+            poolp->m_freeps[sizeClass] = framep;
+            poolp->addLive(-1);
+            return;
+        }
+        deallocateSlow(poolp, ptr, size);
+    }
+    // Print frame allocation statistics of all threads
+    static void statsPrint() VL_MT_SAFE;
+};
+
 //=============================================================================
 // VlCoroutine
 // Return value of a coroutine. Used for chaining coroutine suspension/resumption.
@@ -428,6 +604,12 @@ private:
 
         ~VlPromise();
 
+        // Allocate coroutine frames from the pool
+        static void* operator new(size_t size) { return VlCoroutineFramePool::allocate(size); }
+        static void operator delete(void* ptr, size_t size) {
+            VlCoroutineFramePool::deallocate(ptr, size);
+        }
+
         VlCoroutine get_return_object() { return {this}; }
 
         // Never suspend at the start of the coroutine
@@ -32,6 +32,7 @@
 #include <array>
 #include <atomic>
 #include <deque>
+#include <functional>
 #include <map>
 #include <memory>
 #include <set>
@@ -254,6 +255,21 @@ public:
 
 inline uint64_t vl_rand64() VL_MT_SAFE { return VlRNG::vl_thread_rng_rand64(); }
 
+// RNG for filling large regions, e.g. random reset of memories.  Runs
+// independent Xoroshiro128+ generators in lockstep; the lanes have no
+// dependencies on each other so the compiler may keep them in vector
+// registers.  Not a replacement for VlRNG, the sequence differs.
+class VlRNGBulk final {
+    static constexpr size_t LANES = 4;  // Generators stepped together
+    uint64_t m_state0[LANES];  // First state word of each lane
+    uint64_t m_state1[LANES];  // Second state word of each lane
+
+public:
+    explicit VlRNGBulk(uint64_t seed) VL_MT_SAFE;
+    // Fill given number of bytes with random data
+    void fill(void* datap, size_t bytes) VL_MT_UNSAFE;
+};
+
 // RNG for shuffle()
 class VlURNG final {
 public:
@@ -1832,6 +1848,51 @@ public:
     void deleteAll() VL_EXCLUDES(m_mutex) VL_EXCLUDES(m_deleteMutex) VL_MT_SAFE;
 };
 
+//===================================================================
+// Queue of calls to dpi_deferred DPI imports. Calls are queued during eval, then
+// dispatch() at the end of eval makes them, either directly, or if asynchronous on a
+// worker thread while the next eval runs.
+
+class VlDpiDeferredWorker;
+
+class VlDpiDeferred final {
+public:
+    // TYPES
+    using Call = std::function<void()>;
+
+private:
+    // MEMBERS
+    mutable VerilatedMutex m_mutex;  // Mutex protecting the pending queue
+    std::vector<Call> m_pending VL_GUARDED_BY(m_mutex);  // Calls queued by current eval
+    std::vector<Call> m_running;  // Calls being made, if synchronous
+    VlDpiDeferredWorker* m_workerp = nullptr;  // Worker thread, if asynchronous
+
+public:
+    // CONSTRUCTOR
+    explicit VlDpiDeferred(bool async);
+    ~VlDpiDeferred();
+
+private:
+    VL_UNCOPYABLE(VlDpiDeferred);
+
+public:
+    // METHODS
+    // Queue a call, from any thread
+    void push(Call&& call) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        const VerilatedLockGuard lock{m_mutex};
+        m_pending.push_back(std::move(call));
+    }
+    // Make the queued calls, or hand them to the worker thread
+    void dispatch() VL_MT_SAFE_EXCLUDES(m_mutex);
+    // Wait for calls handed to the worker thread to complete
+    void wait() VL_MT_SAFE;
+    // Make the queued calls and wait for them to complete
+    void flush() VL_MT_SAFE_EXCLUDES(m_mutex) {
+        dispatch();
+        wait();
+    }
+};
+
 //===================================================================
 // Base class for all verilated classes. Includes a reference counter, and a pointer to the deleter
 // object that should destroy it after the counter reaches 0. This allows for easy construction of
@@ -33,12 +33,14 @@
 
 #include "vltstd/vpi_user.h"
 
+#include <algorithm>
 #include <cstdarg>
 #include <cstdio>
+#include <deque>
 #include <list>
-#include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -131,19 +133,19 @@ public:
     virtual PLI_INT32 dovpi_remove_cb() { return 0; }
 };
 
+class VerilatedVpiCbHolder;
+
 class VerilatedVpioReasonCb final : public VerilatedVpio {
     // A handle to a timed or non-timed callback created with vpi_register_cb
     // User can call vpi_remove_cb or vpi_release_handle on it
+    VerilatedVpiCbHolder* const m_holderp;  // Holder, reused after the callback, so check m_id
     const uint64_t m_id;  // Unique id/sequence number to find schedule's event
-    const QData m_time;  // Scheduled time, or 0 = not timed
-    const PLI_INT32 m_reason;  // VPI callback reason code
 
 public:
     // cppcheck-suppress uninitVar  // m_value
-    VerilatedVpioReasonCb(uint64_t id, QData time, PLI_INT32 reason)
-        : m_id{id}
-        , m_time{time}
-        , m_reason{reason} {}
+    VerilatedVpioReasonCb(VerilatedVpiCbHolder* holderp, uint64_t id)
+        : m_holderp{holderp}
+        , m_id{id} {}
     ~VerilatedVpioReasonCb() override = default;
     // cppcheck-suppress duplInheritedMember
     static VerilatedVpioReasonCb* castp(vpiHandle h) {
@@ -224,6 +226,8 @@ public:
     const VerilatedRange* rangep() const override { return get_range(); }
     const char* name() const override { return m_varp->name(); }
     const char* fullname() const override { return m_fullname.c_str(); }
+    // Full name without any index, constant for the life of the object
+    const char* scopedName() const { return m_fullname.c_str(); }
     virtual void* varDatap() const { return m_varp->datap(); }
     CData* varCDatap() const {
         VL_DEBUG_IFDEF(assert(varp()->vltype() == VLVT_UINT8););
@@ -702,14 +706,17 @@ using VerilatedPliCb = PLI_INT32 (*)(struct t_cb_data*);
 class VerilatedVpiCbHolder final {
     // Holds information needed to call a callback
     uint64_t m_id;  // Unique id/sequence number to find schedule's event, 0 = invalid
+    QData m_time;  // Scheduled time, or 0 = not timed
     s_cb_data m_cbData;
     s_vpi_value m_value;
     VerilatedVpioVar m_varo;  // If a cbValueChange callback, the object we will return
 
 public:
     // cppcheck-suppress uninitVar  // m_value
-    VerilatedVpiCbHolder(uint64_t id, const s_cb_data* cbDatap, const VerilatedVpioVar* varop)
+    VerilatedVpiCbHolder(uint64_t id, const s_cb_data* cbDatap, const VerilatedVpioVar* varop,
+                         QData time = 0)
         : m_id{id}
+        , m_time{time}
         , m_cbData{*cbDatap}
         , m_varo{varop} {
         m_value.format = cbDatap->value ? cbDatap->value->format : vpiSuppressVal;
@@ -722,9 +729,19 @@ public:
         }
     }
     ~VerilatedVpiCbHolder() = default;
+    // Reuse a holder of a callback already called or removed, other than cbValueChange
+    void reinit(uint64_t id, const s_cb_data* cbDatap, QData time) {
+        m_id = id;
+        m_time = time;
+        m_cbData = *cbDatap;
+        m_value.format = cbDatap->value ? cbDatap->value->format : vpiSuppressVal;
+        m_cbData.value = &m_value;
+        m_cbData.obj = nullptr;
+    }
     VerilatedPliCb cb_rtnp() const { return m_cbData.cb_rtn; }
     s_cb_data* cb_datap() { return &m_cbData; }
     uint64_t id() const { return m_id; }
+    QData time() const { return m_time; }
     bool invalid() const { return !m_id; }
     void invalidate() { m_id = 0; }
 };
@@ -869,13 +886,19 @@ public:
     }
 };
 
+struct VerilatedVpiTimedCb final {
+    // Entry in the heap of callbacks for future timestamps
+    QData m_time;  // Scheduled time
+    uint64_t m_id;  // Callback unique id, so same time callbacks are called in order
+    std::list<VerilatedVpiCbHolder>::iterator m_it;  // Holder, in m_cbFutureList
+};
+
 struct VerilatedVpiTimedCbsCmp final {
-    // Ordering sets keyed by time, then callback unique id
-    bool operator()(const std::pair<QData, uint64_t>& a,
-                    const std::pair<QData, uint64_t>& b) const {
-        if (a.first < b.first) return true;
-        if (a.first > b.first) return false;
-        return a.second < b.second;
+    // Ordering the heap so the front is the earliest time, then lowest callback unique id
+    bool operator()(const VerilatedVpiTimedCb& a, const VerilatedVpiTimedCb& b) const {
+        if (a.m_time > b.m_time) return true;
+        if (a.m_time < b.m_time) return false;
+        return a.m_id > b.m_id;
     }
 };
 
@@ -885,19 +908,45 @@ void vl_vpi_put_word(const VerilatedVpioVar* vop, QData word, size_t bitCount, s
 class VerilatedVpiImp final {
     enum { CB_ENUM_MAX_VALUE = cbAtEndOfSimTime + 1 };  // Maximum callback reason
     using VpioCbList = std::list<VerilatedVpiCbHolder>;
-    using VpioFutureCbs = std::map<std::pair<QData, uint64_t>, VerilatedVpiCbHolder>;
+    using VpioFutureCbs = std::vector<VerilatedVpiTimedCb>;
+    struct NameCacheEntry final {
+        const VerilatedVar* m_varp;  // Variable found
+        const VerilatedScope* m_scopep;  // Scope containing m_varp
+    };
+    using VpioNameCache = std::unordered_map<const char*, NameCacheEntry, VerilatedCStrHash,
+                                             VerilatedCStrEq>;
 
     // All only medium-speed, so use singleton function
     // Callbacks that are past or at current timestamp
     std::array<VpioCbList, CB_ENUM_MAX_VALUE> m_cbCurrentLists;
     VpioCbList m_cbCallList;  // List of callbacks currently being called by callCbs
-    VpioFutureCbs m_futureCbs;  // Time based callbacks for future timestamps
-    VpioFutureCbs m_nextCbs;  // cbNextSimTime callbacks
+    // Holders are moved between lists with splice, and those of called or removed callbacks
+    // kept in m_cbFreeList for reuse, so registering a callback does not usually allocate
+    VpioCbList m_cbFreeList;  // Holders for reuse
+    VpioCbList m_cbFutureList;  // Holders of callbacks in m_futureCbs, unordered
+    VpioFutureCbs m_futureCbs;  // Heap of time based callbacks for future timestamps
+    VpioCbList m_nextCbs;  // cbNextSimTime callbacks, in registration so time order
     std::list<VerilatedVpiPutHolder> m_inertialPuts;  // Pending vpi puts due to vpiInertialDelay
     VerilatedVpiError* m_errorInfop = nullptr;  // Container for vpi error info
     VerilatedAssertOneThread m_assertOne;  // Assert only called from single thread
     uint64_t m_nextCallbackId = 1;  // Id to identify callback
+    // cbValueChange callbacks, indexed from m_cbCurrentLists[cbValueChange] by callValueCbs
+    std::vector<uint8_t*> m_valueDirtyps;  // Flags of variables with callbacks
+    std::vector<std::vector<VerilatedVpiCbHolder*>> m_valueWatches;  // Callbacks per flag
+    std::vector<VerilatedVpiCbHolder*> m_valuePolled;  // Callbacks on other variables
+    std::vector<VerilatedVpiCbHolder*> m_valueCalls;  // Callbacks to test, temporary
+    std::unordered_map<uint8_t*, size_t> m_valueWatchIndex;  // Dirty flag to m_valueWatches index
+    size_t m_valueCbs = 0;  // Number of cbValueChange callbacks, including removed
+    size_t m_valueRemoved = 0;  // Number of removed callbacks not yet compacted
     bool m_evalNeeded = false;  // Model has had signals updated via vpi_put_value()
+    // vpi_handle_by_name variables, by full name, so repeated lookups skip the search.
+    // Handles are still allocated per lookup, as each is the user's to release.
+    VpioNameCache m_nameCache;
+    std::deque<std::string> m_nameCacheKeys;  // Storage for m_nameCache keys
+    const VerilatedContext* m_nameCacheContextp = nullptr;  // Context m_nameCache is from
+    uint64_t m_nameCacheGeneration = 0;  // scopeGeneration() m_nameCache is from
+    std::string m_nameBuf;  // Temporary full name, kept to avoid allocation per lookup
+    std::string m_scopeNameBuf;  // Temporary scope name, kept to avoid allocation per lookup
 
     static VerilatedVpiImp& s() {  // Singleton
         static VerilatedVpiImp s_s;
@@ -908,96 +957,91 @@ public:
     static void assertOneCheck() { s().m_assertOne.check(); }
     static uint64_t nextCallbackId() { return ++s().m_nextCallbackId; }
 
-    static void cbCurrentAdd(uint64_t id, const s_cb_data* cb_data_p) {
+    static VerilatedVpiCbHolder* cbHolderAdd(VpioCbList& list, uint64_t id,
+                                             const s_cb_data* cb_data_p, QData time) {
+        // Add a holder to the end of the list, reusing a free holder if any
+        if (VL_UNLIKELY(s().m_cbFreeList.empty())) {
+            list.emplace_back(id, cb_data_p, nullptr, time);
+        } else {
+            list.splice(list.end(), s().m_cbFreeList, s().m_cbFreeList.begin());
+            list.back().reinit(id, cb_data_p, time);
+        }
+        return &list.back();
+    }
+    static void cbHolderFree(VpioCbList& list, VpioCbList::iterator it) {
+        s().m_cbFreeList.splice(s().m_cbFreeList.end(), list, it);
+    }
+    static VerilatedVpiCbHolder* cbCurrentAdd(uint64_t id, const s_cb_data* cb_data_p) {
         // The passed cb_data_p was property of the user, so need to recreate
         if (VL_UNCOVERABLE(cb_data_p->reason >= CB_ENUM_MAX_VALUE)) {
             VL_FATAL_MT(__FILE__, __LINE__, "", "vpi bb reason too large");
         }
         VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: vpi_register_cb reason=%d id=%" PRId64 " obj=%p\n",
                                     cb_data_p->reason, id, cb_data_p->obj););
-        VerilatedVpioVar* varop = nullptr;
-        if (cb_data_p->reason == cbValueChange) varop = VerilatedVpioVar::castp(cb_data_p->obj);
-        s().m_cbCurrentLists[cb_data_p->reason].emplace_back(id, cb_data_p, varop);
-    }
-    static void cbFutureAdd(uint64_t id, const s_cb_data* cb_data_p, QData time) {
+        VpioCbList& cbObjList = s().m_cbCurrentLists[cb_data_p->reason];
+        if (cb_data_p->reason != cbValueChange) return cbHolderAdd(cbObjList, id, cb_data_p, 0);
+        // Value change holders have their own object, so are not reused
+        const VerilatedVpioVar* const varop = VerilatedVpioVar::castp(cb_data_p->obj);
+        cbObjList.emplace_back(id, cb_data_p, varop);
+        if (varop) valueCbAdd(&cbObjList.back());
+        return &cbObjList.back();
+    }
+    static VerilatedVpiCbHolder* cbFutureAdd(uint64_t id, const s_cb_data* cb_data_p,
+                                             QData time) {
         // The passed cb_data_p was property of the user, so need to recreate
         VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: vpi_register_cb reason=%d id=%" PRId64 " time=%" PRIu64
                                     " obj=%p\n",
                                     cb_data_p->reason, id, time, cb_data_p->obj););
-        s().m_futureCbs.emplace(std::piecewise_construct, std::forward_as_tuple(time, id),
-                                std::forward_as_tuple(id, cb_data_p, nullptr));
+        VerilatedVpiCbHolder* const hop = cbHolderAdd(s().m_cbFutureList, id, cb_data_p, time);
+        s().m_futureCbs.push_back({time, id, std::prev(s().m_cbFutureList.end())});
+        std::push_heap(s().m_futureCbs.begin(), s().m_futureCbs.end(), VerilatedVpiTimedCbsCmp{});
+        return hop;
     }
-    static void cbNextAdd(uint64_t id, const s_cb_data* cb_data_p, QData time) {
+    static VerilatedVpiCbHolder* cbNextAdd(uint64_t id, const s_cb_data* cb_data_p, QData time) {
         // The passed cb_data_p was property of the user, so need to recreate
         VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: vpi_register_cb reason=%d(NEXT) id=%" PRId64
                                     " time=%" PRIu64 " obj=%p\n",
                                     cb_data_p->reason, id, time, cb_data_p->obj););
-        s().m_nextCbs.emplace(std::piecewise_construct, std::forward_as_tuple(time, id),
-                              std::forward_as_tuple(id, cb_data_p, nullptr));
+        // Time only increases, so appending keeps the list in time order
+        return cbHolderAdd(s().m_nextCbs, id, cb_data_p, time);
     }
-    static void cbReasonRemove(uint64_t id, uint32_t reason, QData time) {
-        // Id might no longer exist, if already removed due to call after event, or teardown
+    static void cbRemove(VerilatedVpiCbHolder* hop, uint64_t id) {
+        // Holder may have been reused, if already removed due to call after event
+        if (hop->id() != id) return;
         // We do not remove it now as we may be iterating the list,
-        // instead set to nullptr and will cleanup later
-        // Remove from cbCurrent queue
-        for (auto& ir : s().m_cbCurrentLists[reason]) {
-            if (ir.id() == id) {
-                ir.invalidate();
-                return;  // Once found, it won't also be in m_cbCallList, m_futureCbs, or m_nextCbs
-            }
-        }
-        for (auto& ir : s().m_cbCallList) {
-            if (ir.id() == id) {
-                ir.invalidate();
-                return;  // Once found, it won't also be in m_futureCbs or m_nextCbs
-            }
-        }
-        {  // Remove from cbFuture queue
-            const auto it = s().m_futureCbs.find(std::make_pair(time, id));
-            if (it != s().m_futureCbs.end()) {
-                it->second.invalidate();
-                return;
-            }
-        }
-        {  // Remove from cbNext
-            const auto it = s().m_nextCbs.find(std::make_pair(time, id));
-            if (it != s().m_nextCbs.end()) {
-                it->second.invalidate();
-                return;
-            }
-        }
+        // instead invalidate and will cleanup later
+        hop->invalidate();
+        if (hop->cb_datap()->reason == cbValueChange) ++s().m_valueRemoved;
     }
     static void moveFutureCbs() VL_MT_UNSAFE_ONE {
         // For any events past current time, move from cbFuture queue to cbCurrent queue
         if (s().m_futureCbs.empty() && s().m_nextCbs.empty()) return;
         // VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: moveFutureCbs\n"); dumpCbs(); );
         const QData time = VL_TIME_Q();
-        for (auto it = s().m_futureCbs.begin();  //
-             VL_UNLIKELY(it != s().m_futureCbs.end() && it->first.first <= time);) {
-            VerilatedVpiCbHolder& hor = it->second;
-            const auto last_it = it;
-            ++it;
-            if (VL_UNLIKELY(!hor.invalid())) {
-                VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: moveFutureCbs id=%" PRId64 "\n", hor.id()););
-                s().m_cbCurrentLists[hor.cb_datap()->reason].emplace_back(hor);
-            }
-            s().m_futureCbs.erase(last_it);
-        }
-        for (auto it = s().m_nextCbs.begin();  //
-             VL_UNLIKELY(it != s().m_nextCbs.end() && it->first.first < time);) {
-            VerilatedVpiCbHolder& hor = it->second;
-            const auto last_it = it;
-            ++it;
-            if (VL_UNLIKELY(!hor.invalid())) {
-                VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: moveFutureCbs id=%" PRId64 "\n", hor.id()););
-                s().m_cbCurrentLists[hor.cb_datap()->reason].emplace_back(hor);
-            }
-            s().m_nextCbs.erase(last_it);
+        VpioFutureCbs& futureCbs = s().m_futureCbs;
+        while (VL_UNLIKELY(!futureCbs.empty() && futureCbs.front().m_time <= time)) {
+            const auto it = futureCbs.front().m_it;
+            std::pop_heap(futureCbs.begin(), futureCbs.end(), VerilatedVpiTimedCbsCmp{});
+            futureCbs.pop_back();
+            cbMoveCurrent(s().m_cbFutureList, it);
         }
+        VpioCbList& nextCbs = s().m_nextCbs;
+        while (VL_UNLIKELY(!nextCbs.empty() && nextCbs.front().time() < time)) {
+            cbMoveCurrent(nextCbs, nextCbs.begin());
+        }
+    }
+    static void cbMoveCurrent(VpioCbList& list, VpioCbList::iterator it) VL_MT_UNSAFE_ONE {
+        // Move a due callback to its cbCurrent queue, or if removed free it
+        if (VL_UNLIKELY(it->invalid())) {
+            cbHolderFree(list, it);
+            return;
+        }
+        VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: moveFutureCbs id=%" PRId64 "\n", it->id()););
+        VpioCbList& cbObjList = s().m_cbCurrentLists[it->cb_datap()->reason];
+        cbObjList.splice(cbObjList.end(), list, it);
     }
     static QData cbNextDeadline() {
-        const auto it = s().m_futureCbs.cbegin();
-        if (VL_LIKELY(it != s().m_futureCbs.cend())) return it->first.first;
+        if (VL_LIKELY(!s().m_futureCbs.empty())) return s().m_futureCbs.front().m_time;
         return ~0ULL;  // maxquad
     }
     static bool hasCbs(const uint32_t reason) VL_MT_UNSAFE_ONE {
@@ -1012,7 +1056,7 @@ public:
         std::swap(s().m_cbCurrentLists[reason], s().m_cbCallList);
         bool called = false;
         for (VerilatedVpiCbHolder& ihor : s().m_cbCallList) {
-            // cbReasonRemove sets to nullptr, so we know on removal the old end() will still exist
+            // cbRemove invalidates, so we know on removal the old end() will still exist
             if (VL_LIKELY(!ihor.invalid())) {  // Not deleted earlier
                 VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: reason_callback reason=%d id=%" PRId64 "\n",
                                             reason, ihor.id()););
@@ -1021,48 +1065,125 @@ public:
                 called = true;
             }
         }
-        s().m_cbCallList.clear();
+        s().m_cbFreeList.splice(s().m_cbFreeList.end(), s().m_cbCallList);
         return called;
     }
+    static void valueCbAdd(VerilatedVpiCbHolder* hop) VL_MT_UNSAFE_ONE {
+        // Index a cbValueChange callback by the dirty flag of its variable, if any
+        ++s().m_valueCbs;
+        const VerilatedVpioVar* const varop
+            = reinterpret_cast<VerilatedVpioVar*>(hop->cb_datap()->obj);
+        uint8_t* const dirtyp = varop->varp()->dirtyp();
+        if (!dirtyp) {
+            s().m_valuePolled.push_back(hop);
+            return;
+        }
+        const auto pair = s().m_valueWatchIndex.emplace(dirtyp, s().m_valueDirtyps.size());
+        if (pair.second) {
+            s().m_valueDirtyps.push_back(dirtyp);
+            s().m_valueWatches.emplace_back();
+        }
+        s().m_valueWatches[pair.first->second].push_back(hop);
+    }
+    static void valueCbsCompact() VL_MT_UNSAFE_ONE {
+        // Delete removed callbacks, and rebuild the index from the remainder
+        VpioCbList& cbObjList = s().m_cbCurrentLists[cbValueChange];
+        s().m_valueDirtyps.clear();
+        s().m_valueWatches.clear();
+        s().m_valuePolled.clear();
+        s().m_valueWatchIndex.clear();
+        s().m_valueCbs = 0;
+        s().m_valueRemoved = 0;
+        for (auto it = cbObjList.begin(); it != cbObjList.end();) {
+            if (VL_UNLIKELY(it->invalid())) {
+                it = cbObjList.erase(it);
+            } else {
+                valueCbAdd(&*it++);
+            }
+        }
+    }
+    static bool callValueCb(VerilatedVpiCbHolder& ho, std::vector<VerilatedVpioVar*>& update)
+        VL_MT_UNSAFE_ONE {
+        // cbRemove invalidates, and the holder remains until compacted
+        if (VL_UNLIKELY(ho.invalid())) return false;
+        VerilatedVpioVar* const varop = reinterpret_cast<VerilatedVpioVar*>(ho.cb_datap()->obj);
+        void* const newDatap = varop->varDatap();
+        void* const prevDatap = varop->prevDatap();  // Was malloced when we added the callback
+        VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: value_test %s v[0]=%d/%d %p %p\n",
+                                    varop->fullname(), *(static_cast<CData*>(newDatap)),
+                                    *(static_cast<CData*>(prevDatap)), newDatap, prevDatap););
+        if (std::memcmp(prevDatap, newDatap, varop->entSize()) == 0) return false;
+        VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: value_callback %" PRId64 " %s v[0]=%d\n", ho.id(),
+                                    varop->fullname(), *(static_cast<CData*>(newDatap))););
+        update.push_back(varop);
+        vpi_get_value(ho.cb_datap()->obj, ho.cb_datap()->value);
+        (ho.cb_rtnp())(ho.cb_datap());
+        return true;
+    }
     static bool callValueCbs() VL_MT_UNSAFE_ONE {
         assertOneCheck();
-        VpioCbList& cbObjList = s().m_cbCurrentLists[cbValueChange];
+        if (VL_UNLIKELY(s().m_valueRemoved * 2 > s().m_valueCbs)) valueCbsCompact();
+        // Test callbacks on variables that have no dirty flag, or have been written
+        std::vector<VerilatedVpiCbHolder*>& calls = s().m_valueCalls;
+        calls.clear();
+        const size_t nwatches = s().m_valueDirtyps.size();
+        uint8_t* const* const dirtypp = s().m_valueDirtyps.data();
+        for (size_t i = 0; i < nwatches; ++i) {
+            if (VL_LIKELY(!*dirtypp[i])) continue;
+            *dirtypp[i] = 0;
+            const std::vector<VerilatedVpiCbHolder*>& holderps = s().m_valueWatches[i];
+            calls.insert(calls.end(), holderps.begin(), holderps.end());
+        }
         bool called = false;
-        std::set<VerilatedVpioVar*> update;  // set of objects to update after callbacks
-        if (cbObjList.empty()) return called;
-        const auto last = std::prev(cbObjList.end());  // prevent looping over newly added elements
-        for (auto it = cbObjList.begin(); true;) {
-            // cbReasonRemove sets to nullptr, so we know on removal the old end() will still exist
-            const bool was_last = it == last;
-            if (VL_UNLIKELY(it->invalid())) {  // Deleted earlier, cleanup
-                it = cbObjList.erase(it);
-                if (was_last) break;
-                continue;
+        std::vector<VerilatedVpioVar*> update;  // Objects to update after callbacks
+        // Callbacks may add callbacks, so only call those present at the start, by index
+        if (calls.empty()) {
+            const size_t size = s().m_valuePolled.size();
+            for (size_t i = 0; i < size; ++i) {
+                if (callValueCb(*s().m_valuePolled[i], update)) called = true;
             }
-            VerilatedVpiCbHolder& ho = *it++;
-            VerilatedVpioVar* const varop
-                = reinterpret_cast<VerilatedVpioVar*>(ho.cb_datap()->obj);
-            void* const newDatap = varop->varDatap();
-            void* const prevDatap = varop->prevDatap();  // Was malloced when we added the callback
-            VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: value_test %s v[0]=%d/%d %p %p\n",
-                                        varop->fullname(), *(static_cast<CData*>(newDatap)),
-                                        *(static_cast<CData*>(prevDatap)), newDatap, prevDatap););
-            if (std::memcmp(prevDatap, newDatap, varop->entSize()) != 0) {
-                VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: value_callback %" PRId64 " %s v[0]=%d\n",
-                                            ho.id(), varop->fullname(),
-                                            *(static_cast<CData*>(newDatap))););
-                update.insert(varop);
-                vpi_get_value(ho.cb_datap()->obj, ho.cb_datap()->value);
-                (ho.cb_rtnp())(ho.cb_datap());
-                called = true;
+        } else {
+            // Call in the order registered, as would when testing every callback
+            if (!s().m_valuePolled.empty()) {
+                calls.insert(calls.end(), s().m_valuePolled.begin(), s().m_valuePolled.end());
+            }
+            std::sort(calls.begin(), calls.end(),
+                      [](const VerilatedVpiCbHolder* ap, const VerilatedVpiCbHolder* bp) {
+                          return ap->id() < bp->id();
+                      });
+            for (VerilatedVpiCbHolder* const hop : calls) {
+                if (callValueCb(*hop, update)) called = true;
             }
-            if (was_last) break;
         }
+        // Each callback has its own varop, so no duplicates
         for (const VerilatedVpioVar* const ip : update) {
             std::memcpy(ip->prevDatap(), ip->varDatap(), ip->entSize());
         }
         return called;
     }
+    static std::string& nameBuf() VL_MT_UNSAFE_ONE { return s().m_nameBuf; }
+    static std::string& scopeNameBuf() VL_MT_UNSAFE_ONE { return s().m_scopeNameBuf; }
+    static const NameCacheEntry* nameCacheFind(const char* namep) VL_MT_UNSAFE_ONE {
+        const VerilatedContext* const contextp = Verilated::threadContextp();
+        const uint64_t generation = VerilatedContextImp::scopeGeneration();
+        if (VL_UNLIKELY(contextp != s().m_nameCacheContextp
+                        || generation != s().m_nameCacheGeneration)) {
+            s().m_nameCache.clear();
+            s().m_nameCacheKeys.clear();
+            s().m_nameCacheContextp = contextp;
+            s().m_nameCacheGeneration = generation;
+            return nullptr;
+        }
+        const auto it = s().m_nameCache.find(namep);
+        if (it == s().m_nameCache.end()) return nullptr;
+        return &it->second;
+    }
+    static void nameCacheInsert(const char* namep, const VerilatedVar* varp,
+                                const VerilatedScope* scopep) VL_MT_UNSAFE_ONE {
+        s().m_nameCacheKeys.emplace_back(namep);
+        s().m_nameCache.emplace(s().m_nameCacheKeys.back().c_str(),
+                                NameCacheEntry{varp, scopep});
+    }
     static void dumpCbs() VL_MT_UNSAFE_ONE;
     static VerilatedVpiError* error_info() VL_MT_UNSAFE_ONE;  // getter for vpi error info
     static bool evalNeeded() { return s().m_evalNeeded; }
@@ -1218,7 +1339,7 @@ QData VerilatedVpi::cbNextDeadline() VL_MT_UNSAFE_ONE { return VerilatedVpiImp::
 void VerilatedVpi::dumpCbs() VL_MT_UNSAFE_ONE { VerilatedVpiImp::dumpCbs(); }
 
 PLI_INT32 VerilatedVpioReasonCb::dovpi_remove_cb() {
-    VerilatedVpiImp::cbReasonRemove(m_id, m_reason, m_time);
+    VerilatedVpiImp::cbRemove(m_holderp, m_id);
     delete this;  // IEEE 37.2.2 a vpi_remove_cb does a vpi_release_handle
     return 1;
 }
@@ -1228,6 +1349,147 @@ bool VerilatedVpi::evalNeeded() VL_MT_UNSAFE_ONE { return VerilatedVpiImp::evalN
 
 void VerilatedVpi::doInertialPuts() VL_MT_UNSAFE_ONE { VerilatedVpiImp::doInertialPuts(); }
 
+//======================================================================
+// VerilatedVpiGroup implementation
+
+bool VerilatedVpiGroup::add(vpiHandle handle) VL_MT_UNSAFE_ONE {
+    VerilatedVpiImp::assertOneCheck();
+    VL_VPI_ERROR_RESET_();
+    const VerilatedVpioVarBase* const vop = VerilatedVpioVarBase::castp(handle);
+    if (VL_UNLIKELY(!vop)) {
+        VL_VPI_ERROR_(__FILE__, __LINE__, "VerilatedVpiGroup::add: Unsupported vpiHandle (%p)",
+                      handle);
+        return false;
+    }
+    const VerilatedVar* const varp = vop->varp();
+    const VerilatedVarType vltype = varp->vltype();
+    if (VL_UNLIKELY(vop->indexedDim() + 1 != varp->udims() || vop->bitOffset()
+                    || vltype < VLVT_UINT8 || vltype == VLVT_STRING)) {
+        VL_VPI_ERROR_(__FILE__, __LINE__,
+                      "VerilatedVpiGroup::add: Unsupported variable '%s',"
+                      " only whole packed values may be grouped",
+                      vop->fullname());
+        return false;
+    }
+    if (VL_UNLIKELY(varp->isForceable())) {
+        // Storage is not the forced value, use vpi_get_value/vpi_put_value instead
+        VL_VPI_ERROR_(__FILE__, __LINE__,
+                      "VerilatedVpiGroup::add: Unsupported forceable variable '%s'",
+                      vop->fullname());
+        return false;
+    }
+    Member member;
+    member.m_varp = varp;
+    member.m_datap = vop->varDatap();
+    member.m_dirtyp = varp->dirtyp();
+    member.m_offset = static_cast<uint32_t>(m_bytes);
+    member.m_size = varp->entSize();
+    member.m_bits = varp->entBits();
+    member.m_vltype = static_cast<uint8_t>(vltype);
+    member.m_writable = varp->isPublicRW();
+    m_members.push_back(member);
+    m_bytes += member.m_size;
+    m_prev.resize(m_bytes);
+    m_gotten = false;  // So next get() reports all as changed
+    return true;
+}
+
+// Copy a value, with a constant size for the common widths so is inlined
+static inline void vl_vpi_group_copy(void* dstp, const void* srcp, uint32_t size) {
+    switch (size) {
+    case 1: std::memcpy(dstp, srcp, 1); break;
+    case 2: std::memcpy(dstp, srcp, 2); break;
+    case 4: std::memcpy(dstp, srcp, 4); break;
+    case 8: std::memcpy(dstp, srcp, 8); break;
+    default: std::memcpy(dstp, srcp, size); break;
+    }
+}
+
+void VerilatedVpiGroup::get(void* bufp, uint8_t* changedp) VL_MT_UNSAFE_ONE {
+    VerilatedVpiImp::assertOneCheck();
+    uint8_t* const outp = static_cast<uint8_t*>(bufp);
+    if (!changedp) {
+        for (const Member& m : m_members) {
+            vl_vpi_group_copy(outp + m.m_offset, m.m_datap, m.m_size);
+        }
+        return;
+    }
+    std::memset(changedp, 0, (m_members.size() + 7) / 8);
+    uint8_t* const prevp = m_prev.data();
+    for (size_t i = 0; i < m_members.size(); ++i) {
+        const Member& m = m_members[i];
+        uint8_t* const mprevp = prevp + m.m_offset;
+        if (!m_gotten || std::memcmp(mprevp, m.m_datap, m.m_size) != 0) {
+            changedp[i >> 3] |= 1 << (i & 7);
+            vl_vpi_group_copy(mprevp, m.m_datap, m.m_size);
+        }
+        vl_vpi_group_copy(outp + m.m_offset, mprevp, m.m_size);
+    }
+    m_gotten = true;
+}
+
+// Store a value masked to its width, returning true if it changed
+template <typename T>
+static inline bool vl_vpi_group_put(void* datap, const uint8_t* srcp, T mask) {
+    T value;
+    std::memcpy(&value, srcp, sizeof(T));
+    value &= mask;
+    if (*static_cast<T*>(datap) == value) return false;
+    *static_cast<T*>(datap) = value;
+    return true;
+}
+
+void VerilatedVpiGroup::put(const void* bufp) VL_MT_UNSAFE_ONE {
+    VerilatedVpiImp::assertOneCheck();
+    VL_VPI_ERROR_RESET_();
+    const uint8_t* const inp = static_cast<const uint8_t*>(bufp);
+    bool anyChanged = false;
+    for (const Member& m : m_members) {
+        if (VL_UNLIKELY(!m.m_writable)) {
+            VL_VPI_ERROR_(__FILE__, __LINE__,
+                          "VerilatedVpiGroup::put: Skipping variable '%s' marked read-only,"
+                          " use public_flat_rw instead",
+                          m.m_varp->name());
+            continue;
+        }
+        const uint8_t* const srcp = inp + m.m_offset;
+        bool changed;
+        switch (m.m_vltype) {
+        case VLVT_UINT8:
+            changed = vl_vpi_group_put<CData>(m.m_datap, srcp, VL_MASK_I(m.m_bits));
+            break;
+        case VLVT_UINT16:
+            changed = vl_vpi_group_put<SData>(m.m_datap, srcp, VL_MASK_I(m.m_bits));
+            break;
+        case VLVT_UINT32:
+            changed = vl_vpi_group_put<IData>(m.m_datap, srcp, VL_MASK_I(m.m_bits));
+            break;
+        case VLVT_UINT64:
+            changed = vl_vpi_group_put<QData>(m.m_datap, srcp, VL_MASK_Q(m.m_bits));
+            break;
+        case VLVT_WDATA: {
+            EData* const wordsp = static_cast<EData*>(m.m_datap);
+            const int words = VL_WORDS_I(m.m_bits);
+            changed = false;
+            for (int w = 0; w < words; ++w) {
+                const EData mask = (w == words - 1) ? VL_MASK_E(m.m_bits) : ~EData{0};
+                changed |= vl_vpi_group_put<EData>(wordsp + w, srcp + w * sizeof(EData), mask);
+            }
+            break;
+        }
+        default:  // VLVT_REAL
+            changed = std::memcmp(m.m_datap, srcp, m.m_size) != 0;
+            if (changed) std::memcpy(m.m_datap, srcp, m.m_size);
+            break;
+        }
+        if (!changed) continue;
+        anyChanged = true;
+        // Written other than by the model, so set any --vpi-change-hooks flag
+        if (m.m_dirtyp) *m.m_dirtyp = 1;
+    }
+    if (anyChanged) VerilatedVpiImp::evalNeeded(true);
+}
+
 //======================================================================
 // VerilatedVpiImp implementation
 
@@ -1243,21 +1505,17 @@ void VerilatedVpiImp::dumpCbs() VL_MT_UNSAFE_ONE {
             }
         }
     }
-    for (auto& ifuture : s().m_nextCbs) {
-        const QData time = ifuture.first.first;
-        VerilatedVpiCbHolder& ho = ifuture.second;
+    for (auto& ho : s().m_nextCbs) {
         if (VL_UNLIKELY(!ho.invalid())) {
-            VL_DBG_MSGF("- vpi:   time=%" PRId64 "(NEXT) reason=%d=%s  id=%" PRId64 "\n", time,
-                        ho.cb_datap()->reason,
+            VL_DBG_MSGF("- vpi:   time=%" PRId64 "(NEXT) reason=%d=%s  id=%" PRId64 "\n",
+                        ho.time(), ho.cb_datap()->reason,
                         VerilatedVpiError::strFromVpiCallbackReason(ho.cb_datap()->reason),
                         ho.id());
         }
     }
-    for (auto& ifuture : s().m_futureCbs) {
-        const QData time = ifuture.first.first;
-        VerilatedVpiCbHolder& ho = ifuture.second;
+    for (auto& ho : s().m_cbFutureList) {
         if (VL_UNLIKELY(!ho.invalid())) {
-            VL_DBG_MSGF("- vpi:   time=%" PRId64 " reason=%d=%s  id=%" PRId64 "\n", time,
+            VL_DBG_MSGF("- vpi:   time=%" PRId64 " reason=%d=%s  id=%" PRId64 "\n", ho.time(),
                         ho.cb_datap()->reason,
                         VerilatedVpiError::strFromVpiCallbackReason(ho.cb_datap()->reason),
                         ho.id());
@@ -2095,19 +2353,17 @@ vpiHandle vpi_register_cb(p_cb_data cb_data_p) {
             }
         }
         const uint64_t id = VerilatedVpiImp::nextCallbackId();
-        VerilatedVpioReasonCb* const vop = new VerilatedVpioReasonCb{id, abstime, reason};
-        if (abstime <= time) {
-            VerilatedVpiImp::cbCurrentAdd(id, cb_data_p);
-        } else {
-            VerilatedVpiImp::cbFutureAdd(id, cb_data_p, abstime);
-        }
+        VerilatedVpiCbHolder* const hop
+            = abstime <= time ? VerilatedVpiImp::cbCurrentAdd(id, cb_data_p)
+                              : VerilatedVpiImp::cbFutureAdd(id, cb_data_p, abstime);
+        VerilatedVpioReasonCb* const vop = new VerilatedVpioReasonCb{hop, id};
         return vop->castVpiHandle();
     }
     case cbNextSimTime: {  // One-shot; time always next; supported via vlt_main.cpp
         const QData time = VL_TIME_Q();
         const uint64_t id = VerilatedVpiImp::nextCallbackId();
-        VerilatedVpioReasonCb* const vop = new VerilatedVpioReasonCb{id, 0, reason};
-        VerilatedVpiImp::cbNextAdd(id, cb_data_p, time);
+        VerilatedVpiCbHolder* const hop = VerilatedVpiImp::cbNextAdd(id, cb_data_p, time);
+        VerilatedVpioReasonCb* const vop = new VerilatedVpioReasonCb{hop, id};
         return vop->castVpiHandle();
     }
     case cbEndOfSimulation:  // FALLTHRU // One-shot; time ignored; supported via vlt_main.cpp
@@ -2118,8 +2374,8 @@ vpiHandle vpi_register_cb(p_cb_data cb_data_p) {
     case cbStartOfSimulation:  // FALLTHRU // One-shot; time ignored; supported via vlt_main.cpp
     case cbValueChange: {  // Multi-shot; supported via vlt_main.cpp
         const uint64_t id = VerilatedVpiImp::nextCallbackId();
-        VerilatedVpioReasonCb* const vop = new VerilatedVpioReasonCb{id, 0, reason};
-        VerilatedVpiImp::cbCurrentAdd(id, cb_data_p);
+        VerilatedVpiCbHolder* const hop = VerilatedVpiImp::cbCurrentAdd(id, cb_data_p);
+        VerilatedVpioReasonCb* const vop = new VerilatedVpioReasonCb{hop, id};
         return vop->castVpiHandle();
     }
     default:
@@ -2149,83 +2405,98 @@ void vpi_get_systf_info(vpiHandle /*object*/, p_vpi_systf_data /*systf_data_p*/)
 
 // for obtaining handles
 
+static VerilatedVpio* vl_vpi_find_by_name(const char* namep) {
+    // This doesn't yet follow the hierarchy in the proper way
+    const VerilatedVar* varp = nullptr;
+    const VerilatedScope* scopep = Verilated::threadContextp()->scopeFind(namep);
+    if (scopep) {  // Whole thing found as a scope
+        if (scopep->type() == VerilatedScope::SCOPE_MODULE) {
+            return new VerilatedVpioModule{scopep};
+        } else if (scopep->type() == VerilatedScope::SCOPE_PACKAGE) {
+            return new VerilatedVpioPackage{scopep};
+        } else {
+            return new VerilatedVpioScope{scopep};
+        }
+    }
+    bool isPackage = false;
+    const size_t len = std::strlen(namep);
+    size_t prevpos = std::string::npos;
+    size_t pos = std::string::npos;
+    // Split hierarchical names at last '.' not inside escaped identifier
+    size_t i = 0;
+    while (i < len) {
+        if (namep[i] == '\\') {
+            while (i < len && namep[i] != ' ') ++i;
+            ++i;  // Proc ' ', it should always be there. Then grab '.' on next cycle
+        } else {
+            while (i < len
+                   && (namep[i] != '.'
+                       && (i + 1 >= len || namep[i] != ':' || namep[i + 1] != ':')))
+                ++i;
+            if (i < len) {
+                prevpos = pos;
+                pos = i++;
+                if (namep[i - 1] == ':') isPackage = true;
+            }
+        }
+    }
+    // Do the split, without allocating strings
+    const char* basenamep = namep;
+    std::string& scopename = VerilatedVpiImp::scopeNameBuf();
+    scopename.clear();
+    if (VL_LIKELY(pos != std::string::npos)) {
+        basenamep = namep + pos + (isPackage ? 2 : 1);
+        scopename.assign(namep, pos);
+        if (scopename == "$unit") scopename = "\\$unit ";
+    }
+    if (prevpos == std::string::npos) {
+        // scopename is a toplevel (no '.' separator), so search in our TOP ports first.
+        scopep = Verilated::threadContextp()->scopeFind("TOP");
+        if (scopep) varp = scopep->varFind(basenamep);
+    }
+    if (!varp) {
+        scopep = Verilated::threadContextp()->scopeFind(scopename.c_str());
+        if (!scopep) return nullptr;
+        varp = scopep->varFind(basenamep);
+    }
+    if (!varp) return nullptr;
+
+    if (varp->isParam()) {
+        return new VerilatedVpioParam{varp, scopep};
+    } else {
+        return new VerilatedVpioVar{varp, scopep};
+    }
+}
+
 vpiHandle vpi_handle_by_name(PLI_BYTE8* namep, vpiHandle scope) {
     VerilatedVpiImp::assertOneCheck();
     VL_VPI_ERROR_RESET_();
     if (VL_UNLIKELY(!namep)) return nullptr;
     VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: vpi_handle_by_name %s %p\n", namep, scope););
-    const VerilatedVar* varp = nullptr;
-    const VerilatedScope* scopep;
     const VerilatedVpioScope* const voScopep = VerilatedVpioScope::castp(scope);
-    std::string scopeAndName = namep;
     if (0 == std::strncmp(namep, "$root.", std::strlen("$root."))) {
         namep += std::strlen("$root.");
-        scopeAndName = namep;
     } else if (voScopep) {
         const bool scopeIsPackage = VerilatedVpioPackage::castp(scope) != nullptr;
-        scopeAndName = std::string{voScopep->fullname()} + (scopeIsPackage ? "" : ".") + namep;
+        std::string& scopeAndName = VerilatedVpiImp::nameBuf();
+        scopeAndName = voScopep->fullname();
+        if (!scopeIsPackage) scopeAndName += '.';
+        scopeAndName += namep;
         namep = const_cast<PLI_BYTE8*>(scopeAndName.c_str());
     }
-    {
-        // This doesn't yet follow the hierarchy in the proper way
-        bool isPackage = false;
-        scopep = Verilated::threadContextp()->scopeFind(namep);
-        if (scopep) {  // Whole thing found as a scope
-            if (scopep->type() == VerilatedScope::SCOPE_MODULE) {
-                return (new VerilatedVpioModule{scopep})->castVpiHandle();
-            } else if (scopep->type() == VerilatedScope::SCOPE_PACKAGE) {
-                return (new VerilatedVpioPackage{scopep})->castVpiHandle();
-            } else {
-                return (new VerilatedVpioScope{scopep})->castVpiHandle();
-            }
-        }
-        std::string basename = scopeAndName;
-        std::string scopename;
-        std::string::size_type prevpos = std::string::npos;
-        std::string::size_type pos = std::string::npos;
-        // Split hierarchical names at last '.' not inside escaped identifier
-        size_t i = 0;
-        while (i < scopeAndName.length()) {
-            if (scopeAndName[i] == '\\') {
-                while (i < scopeAndName.length() && scopeAndName[i] != ' ') ++i;
-                ++i;  // Proc ' ', it should always be there. Then grab '.' on next cycle
-            } else {
-                while (i < scopeAndName.length()
-                       && (scopeAndName[i] != '.'
-                           && (i + 1 >= scopeAndName.length() || scopeAndName[i] != ':'
-                               || scopeAndName[i + 1] != ':')))
-                    ++i;
-                if (i < scopeAndName.length()) {
-                    prevpos = pos;
-                    pos = i++;
-                    if (scopeAndName[i - 1] == ':') isPackage = true;
-                }
-            }
-        }
-        // Do the split
-        if (VL_LIKELY(pos != std::string::npos)) {
-            basename.erase(0, pos + (isPackage ? 2 : 1));
-            scopename = scopeAndName.substr(0, pos);
-            if (scopename == "$unit") scopename = "\\$unit ";
+    // Variables found by full name are cached, so repeated lookups skip the search
+    if (const auto* const entryp = VerilatedVpiImp::nameCacheFind(namep)) {
+        if (entryp->m_varp->isParam()) {
+            return (new VerilatedVpioParam{entryp->m_varp, entryp->m_scopep})->castVpiHandle();
         }
-        if (prevpos == std::string::npos) {
-            // scopename is a toplevel (no '.' separator), so search in our TOP ports first.
-            scopep = Verilated::threadContextp()->scopeFind("TOP");
-            if (scopep) varp = scopep->varFind(basename.c_str());
-        }
-        if (!varp) {
-            scopep = Verilated::threadContextp()->scopeFind(scopename.c_str());
-            if (!scopep) return nullptr;
-            varp = scopep->varFind(basename.c_str());
-        }
-    }
-    if (!varp) return nullptr;
-
-    if (varp->isParam()) {
-        return (new VerilatedVpioParam{varp, scopep})->castVpiHandle();
-    } else {
-        return (new VerilatedVpioVar{varp, scopep})->castVpiHandle();
-    }
+        return (new VerilatedVpioVar{entryp->m_varp, entryp->m_scopep})->castVpiHandle();
+    }
+    VerilatedVpio* const vop = vl_vpi_find_by_name(namep);
+    if (!vop) return nullptr;
+    const VerilatedVpioVarBase* const varop = VerilatedVpioVarBase::castp(vop->castVpiHandle());
+    if (varop && 0 == std::strcmp(varop->scopedName(), namep))
+        VerilatedVpiImp::nameCacheInsert(namep, varop->varp(), varop->scopep());
+    return vop->castVpiHandle();
 }
 
 vpiHandle vpi_handle_by_index(vpiHandle object, PLI_INT32 indx) {
@@ -2952,6 +3223,8 @@ vpiHandle vpi_put_value(vpiHandle object, p_vpi_value valuep, p_vpi_time /*time_
             return object;
         }
         VerilatedVpiImp::evalNeeded(true);
+        // Written other than by the model, so set any --vpi-change-hooks flag
+        if (uint8_t* const dirtyp = baseSignalVop->varp()->dirtyp()) *dirtyp = 1;
         const int varBits = baseSignalVop->bitSize();
 
         const auto forceControlSignals
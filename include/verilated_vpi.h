@@ -69,4 +69,61 @@ public:
     static void selfTest() VL_MT_UNSAFE_ONE;
 };
 
+//======================================================================
+
+/// Group of variables read or written together, a Verilator extension to VPI.
+/// Testbenches accessing many signals each cycle may add their handles
+/// once, then use get() or put() to transfer every value in one call,
+/// instead of a vpi_get_value() or vpi_put_value() per signal.
+///
+/// Values are packed in the order added into a caller-provided buffer of
+/// bytes() bytes.  Each value is in the model's representation, i.e. a
+/// CData, SData, IData, QData, double, or EData words, starting at
+/// offset(), and not necessarily aligned.
+
+class VerilatedVpiGroup final {
+    // TYPES
+    struct Member final {
+        const VerilatedVar* m_varp;  // Variable, for messages
+        void* m_datap;  // Variable's storage
+        uint8_t* m_dirtyp;  // --vpi-change-hooks flag, or nullptr
+        uint32_t m_offset;  // Offset in buffer
+        uint32_t m_size;  // Bytes in buffer
+        uint32_t m_bits;  // Width, for masking put values
+        uint8_t m_vltype;  // VerilatedVarType
+        bool m_writable;  // Public read-write
+    };
+    // MEMBERS
+    std::vector<Member> m_members;
+    std::vector<uint8_t> m_prev;  // Values at last get(), to detect changes
+    size_t m_bytes = 0;  // Buffer size needed
+    bool m_gotten = false;  // get() has filled m_prev
+
+public:
+    // CONSTRUCTORS
+    VerilatedVpiGroup() = default;
+    ~VerilatedVpiGroup() = default;
+    VL_UNCOPYABLE(VerilatedVpiGroup);
+
+    // METHODS
+    /// Add a variable, or an element of an unpacked array variable.
+    /// Returns false and sets vpi_chk_error() if the handle is not supported,
+    /// including if the variable is forceable.
+    /// The handle may be released after adding.
+    bool add(vpiHandle handle) VL_MT_UNSAFE_ONE;
+    /// Number of variables added
+    size_t size() const { return m_members.size(); }
+    /// Size in bytes of buffers for get() and put()
+    size_t bytes() const { return m_bytes; }
+    /// Offset in buffers of the variable added as number index
+    size_t offset(size_t index) const { return m_members[index].m_offset; }
+    /// Read every value into bufp.  If changedp is not nullptr, set bit i
+    /// of the changedp bitmap of (size() + 7) / 8 bytes if variable i
+    /// changed since the previous get() with a changedp, or if none.
+    void get(void* bufp, uint8_t* changedp = nullptr) VL_MT_UNSAFE_ONE;
+    /// Write every value from bufp, as would vpi_put_value() with vpiNoDelay.
+    /// Read-only variables are skipped, with an error from vpi_chk_error().
+    void put(const void* bufp) VL_MT_UNSAFE_ONE;
+};
+
 #endif  // Guard
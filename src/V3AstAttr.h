@@ -786,6 +786,7 @@ public:
         RANDOMIZER_BASIC_STD_RANDOMIZATION,
         RANDOMIZER_CLEARCONSTRAINTS,
         RANDOMIZER_CLEARALL,
+        RANDOMIZER_DIST,
         RANDOMIZER_HARD,
         RANDOMIZER_WRITE_VAR,
         RNG_GET_RANDSTATE,
@@ -794,6 +795,7 @@ public:
         SCHED_AWAITING_CURRENT_TIME,
         SCHED_COMMIT,
         SCHED_DELAY,
+        SCHED_DELAY_PARALLEL,
         SCHED_DO_POST_UPDATES,
         SCHED_ENQUEUE,
         SCHED_EVALUATE,
@@ -801,6 +803,7 @@ public:
         SCHED_POST_UPDATE,
         SCHED_RESUME,
         SCHED_RESUMPTION,
+        SCHED_TOGGLE,
         SCHED_TRIGGER,
         UNPACKED_ASSIGN,
         UNPACKED_FILL,
@@ -915,6 +918,7 @@ inline std::ostream& operator<<(std::ostream& os, const VCMethod& rhs) {
            {RANDOMIZER_BASIC_STD_RANDOMIZATION, "basicStdRandomization", false}, \
            {RANDOMIZER_CLEARCONSTRAINTS, "clearConstraints", false}, \
            {RANDOMIZER_CLEARALL, "clearAll", false}, \
+           {RANDOMIZER_DIST, "dist", false}, \
            {RANDOMIZER_HARD, "hard", false}, \
            {RANDOMIZER_WRITE_VAR, "write_var", false}, \
            {RNG_GET_RANDSTATE, "__Vm_rng.get_randstate", true}, \
@@ -923,6 +927,7 @@ inline std::ostream& operator<<(std::ostream& os, const VCMethod& rhs) {
            {SCHED_AWAITING_CURRENT_TIME, "awaitingCurrentTime", true}, \
            {SCHED_COMMIT, "commit", false}, \
            {SCHED_DELAY, "delay", false}, \
+           {SCHED_DELAY_PARALLEL, "delayParallel", false}, \
            {SCHED_DO_POST_UPDATES, "doPostUpdates", false}, \
            {SCHED_ENQUEUE, "enqueue", false}, \
            {SCHED_EVALUATE, "evaluate", false}, \
@@ -930,6 +935,7 @@ inline std::ostream& operator<<(std::ostream& os, const VCMethod& rhs) {
            {SCHED_POST_UPDATE, "postUpdate", false}, \
            {SCHED_RESUME, "resume", false}, \
            {SCHED_RESUMPTION, "resumption", false}, \
+           {SCHED_TOGGLE, "toggle", false}, \
            {SCHED_TRIGGER, "trigger", false}, \
            {UNPACKED_ASSIGN, "assign", false}, \
            {UNPACKED_FILL, "fill", false}, \
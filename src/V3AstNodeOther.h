@@ -96,6 +96,7 @@ class AstNodeFTask VL_NOT_FINAL : public AstNode {
     bool m_dpiExport : 1;  // DPI exported
     bool m_dpiImport : 1;  // DPI imported
     bool m_dpiContext : 1;  // DPI import context
+    bool m_dpiDeferred : 1;  // DPI import calls deferred to end of eval
     bool m_dpiOpenChild : 1;  // DPI import open array child wrapper
     bool m_dpiTask : 1;  // DPI import task (vs. void function)
     bool m_isConstructor : 1;  // Class constructor
@@ -128,6 +129,7 @@ protected:
         , m_dpiExport{false}
         , m_dpiImport{false}
         , m_dpiContext{false}
+        , m_dpiDeferred{false}
         , m_dpiOpenChild{false}
         , m_dpiTask{false}
         , m_isConstructor{false}
@@ -187,6 +189,8 @@ public:
     void dpiImport(bool flag) { m_dpiImport = flag; }
     bool dpiContext() const { return m_dpiContext; }
     void dpiContext(bool flag) { m_dpiContext = flag; }
+    bool dpiDeferred() const { return m_dpiDeferred; }
+    void dpiDeferred(bool flag) { m_dpiDeferred = flag; }
     bool dpiOpenChild() const { return m_dpiOpenChild; }
     void dpiOpenChild(bool flag) { m_dpiOpenChild = flag; }
     bool dpiTask() const { return m_dpiTask; }
@@ -488,7 +492,9 @@ class AstCFunc final : public AstNode {
     bool m_entryPoint : 1;  // User may call into this top level function
     bool m_dpiPure : 1;  // Pure DPI function
     bool m_dpiContext : 1;  // Declared as 'context' DPI import/export function
+    bool m_dpiDeferred : 1;  // DPI import wrapper queues call until end of eval
     bool m_dpiExportDispatcher : 1;  // This is the DPI export entry point (i.e.: called by user)
+    bool m_dpiExportDirect : 1;  // DPI export dispatcher for a known scope (--dpi-export-direct)
     bool m_dpiExportImpl : 1;  // DPI export implementation (called from DPI dispatcher via lookup)
     bool m_dpiImportPrototype : 1;  // This is the DPI import prototype (i.e.: provided by user)
     bool m_dpiImportWrapper : 1;  // Wrapper for invoking DPI import prototype from generated code
@@ -518,7 +524,9 @@ public:
         m_entryPoint = false;
         m_dpiPure = false;
         m_dpiContext = false;
+        m_dpiDeferred = false;
         m_dpiExportDispatcher = false;
+        m_dpiExportDirect = false;
         m_dpiExportImpl = false;
         m_dpiImportPrototype = false;
         m_dpiImportWrapper = false;
@@ -585,8 +593,12 @@ public:
     void dpiPure(bool flag) { m_dpiPure = flag; }
     bool dpiContext() const { return m_dpiContext; }
     void dpiContext(bool flag) { m_dpiContext = flag; }
+    bool dpiDeferred() const { return m_dpiDeferred; }
+    void dpiDeferred(bool flag) { m_dpiDeferred = flag; }
     bool dpiExportDispatcher() const VL_MT_SAFE { return m_dpiExportDispatcher; }
     void dpiExportDispatcher(bool flag) { m_dpiExportDispatcher = flag; }
+    bool dpiExportDirect() const { return m_dpiExportDirect; }
+    void dpiExportDirect(bool flag) { m_dpiExportDirect = flag; }
     bool dpiExportImpl() const { return m_dpiExportImpl; }
     void dpiExportImpl(bool flag) { m_dpiExportImpl = flag; }
     bool dpiImportPrototype() const VL_MT_SAFE { return m_dpiImportPrototype; }
@@ -1918,6 +1930,7 @@ class AstVar final : public AstNode {
     bool m_isForcedByCode : 1;  // May be forced/released from AstAssignForce/AstRelease
     bool m_isWrittenByDpi : 1;  // This variable can be written by a DPI Export
     bool m_isWrittenBySuspendable : 1;  // This variable can be written by a suspendable process
+    bool m_isWrittenByToggle : 1;  // This variable is inverted by a delay scheduler toggle()
     bool m_ignorePostRead : 1;  // Ignore reads in 'Post' blocks during ordering
     bool m_ignorePostWrite : 1;  // Ignore writes in 'Post' blocks during ordering
     bool m_ignoreSchedWrite : 1;  // Ignore writes in scheduling (for special optimizations)
@@ -1970,6 +1983,7 @@ class AstVar final : public AstNode {
         m_isForcedByCode = false;
         m_isWrittenByDpi = false;
         m_isWrittenBySuspendable = false;
+        m_isWrittenByToggle = false;
         m_ignorePostRead = false;
         m_ignorePostWrite = false;
         m_ignoreSchedWrite = false;
@@ -2133,6 +2147,8 @@ public:
     void setWrittenByDpi() { m_isWrittenByDpi = true; }
     bool isWrittenBySuspendable() const { return m_isWrittenBySuspendable; }
     void setWrittenBySuspendable() { m_isWrittenBySuspendable = true; }
+    bool isWrittenByToggle() const { return m_isWrittenByToggle; }
+    void setWrittenByToggle() { m_isWrittenByToggle = true; }
     bool ignorePostRead() const { return m_ignorePostRead; }
     void setIgnorePostRead() { m_ignorePostRead = true; }
     bool ignorePostWrite() const { return m_ignorePostWrite; }
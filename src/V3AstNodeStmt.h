@@ -422,6 +422,7 @@ public:
 class AstConstraintExpr final : public AstNodeStmt {
     // Constraint expression
     // @astgen op1 := exprp : AstNodeExpr
+    // @astgen op2 := distItemsp : List[AstDistItem] // Constant weights if exprp was a dist
     bool m_isDisableSoft = false;  // Disable soft constraint expression
     bool m_isSoft = false;  // Soft constraint expression
 public:
@@ -2964,6 +2964,7 @@ void AstNodeFTask::dump(std::ostream& str) const {
     if (classMethod()) str << " [METHOD]";
     if (dpiExport()) str << " [DPIX]";
     if (dpiImport()) str << " [DPII]";
+    if (dpiDeferred()) str << " [DPIDEFER]";
     if (dpiOpenChild()) str << " [DPIOPENCHILD]";
     if (dpiOpenParent()) str << " [DPIOPENPARENT]";
     if (isExternDef()) str << " [EXTDEF]";
@@ -3012,6 +3013,7 @@ void AstNodeFTask::dumpJson(std::ostream& str) const {
     dumpJsonBool(str, "method", classMethod());
     dumpJsonBoolFunc(str, dpiExport);
     dumpJsonBoolFunc(str, dpiImport);
+    dumpJsonBoolFuncIf(str, dpiDeferred);
     dumpJsonBoolFunc(str, dpiOpenChild);
     dumpJsonBoolFunc(str, dpiOpenParent);
     dumpJsonBoolFunc(str, isExternDef);
@@ -3167,7 +3169,9 @@ void AstCFunc::dump(std::ostream& str) const {
     if (slow()) str << " [SLOW]";
     if (isStatic()) str << " [STATIC]";
     if (dpiContext()) str << " [DPICTX]";
+    if (dpiDeferred()) str << " [DPIDEFER]";
     if (dpiExportDispatcher()) str << " [DPIED]";
+    if (dpiExportDirect()) str << " [DPIEDD]";
     if (dpiExportImpl()) str << " [DPIEI]";
     if (dpiImportPrototype()) str << " [DPIIP]";
     if (dpiImportWrapper()) str << " [DPIIW]";
@@ -3185,10 +3189,12 @@ void AstCFunc::dumpJson(std::ostream& str) const {
     dumpJsonBoolFunc(str, slow);
     dumpJsonBoolFunc(str, isStatic);
     dumpJsonBoolFunc(str, dpiExportDispatcher);
+    dumpJsonBoolFuncIf(str, dpiExportDirect);
     dumpJsonBoolFunc(str, dpiExportImpl);
     dumpJsonBoolFunc(str, dpiImportPrototype);
     dumpJsonBoolFunc(str, dpiImportWrapper);
     dumpJsonBoolFunc(str, dpiContext);
+    dumpJsonBoolFuncIf(str, dpiDeferred);
     dumpJsonBoolFunc(str, isConstructor);
     dumpJsonBoolFunc(str, isDestructor);
     dumpJsonBoolFunc(str, isVirtual);
@@ -182,6 +182,7 @@ class V3ControlFTask final {
     V3ControlVarResolver m_params;  // Parameters in function/task
     V3ControlVarResolver m_ports;  // Ports in function/task
     V3ControlVarResolver m_vars;  // Variables in function/task
+    bool m_dpiDeferred = false;  // Defer DPI import calls
     bool m_isolate = false;  // Isolate function return
     bool m_noinline = false;  // Don't inline function/task
     bool m_public = false;  // Public function/task
@@ -190,6 +191,7 @@ public:
     V3ControlFTask() = default;
     void update(const V3ControlFTask& f) {
         // Don't overwrite true with false
+        if (f.m_dpiDeferred) m_dpiDeferred = true;
         if (f.m_isolate) m_isolate = true;
         if (f.m_noinline) m_noinline = true;
         if (f.m_public) m_public = true;
@@ -203,6 +205,7 @@ public:
     V3ControlVarResolver& ports() { return m_ports; }
     V3ControlVarResolver& vars() { return m_vars; }
 
+    void setDpiDeferred(bool set) { m_dpiDeferred = set; }
     void setIsolate(bool set) { m_isolate = set; }
     void setNoInline(bool set) { m_noinline = set; }
     void setPublic(bool set) { m_public = set; }
@@ -212,6 +215,7 @@ public:
             ftaskp->addStmtsp(new AstPragma{ftaskp->fileline(), VPragmaType::NO_INLINE_TASK});
         if (m_public)
             ftaskp->addStmtsp(new AstPragma{ftaskp->fileline(), VPragmaType::PUBLIC_TASK});
+        if (m_dpiDeferred) ftaskp->dpiDeferred(true);
         // Only functions can have isolate (return value)
         if (VN_IS(ftaskp, Func)) ftaskp->attrIsolateAssign(m_isolate);
     }
@@ -877,6 +881,14 @@ void V3Control::addCoverageBlockOff(const string& module, const string& blocknam
     V3ControlResolver::s().modules().at(module).addCoverageBlockOff(blockname);
 }
 
+void V3Control::addDpiDeferred(FileLine* fl, const string& module, const string& ftask) {
+    if (ftask.empty()) {
+        fl->v3error("dpi_deferred requires -function or -task");
+    } else {
+        V3ControlResolver::s().modules().at(module).ftasks().at(ftask).setDpiDeferred(true);
+    }
+}
+
 void V3Control::addHierWorkers(FileLine* fl, const string& model, int workers) {
     V3ControlResolver::s().addHierWorkers(fl, model, workers);
 }
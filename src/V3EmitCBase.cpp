@@ -113,12 +113,17 @@ string EmitCBaseVisitorConst::cFuncArgs(const AstCFunc* nodep) {
         if (const AstVar* const portp = VN_CAST(stmtp, Var)) {
             if (portp->isIO() && !portp->isFuncReturn()) {
                 if (!args.empty()) args += ", ";
-                if (nodep->dpiImportPrototype() || nodep->dpiExportDispatcher()) {
+                if (nodep->dpiImportPrototype() || nodep->dpiExportDispatcher()
+                    || nodep->dpiExportDirect()) {
                     args += portp->dpiArgType(true, false);
                 } else if (nodep->funcPublic()) {
                     args += portp->cPubArgType(true, false);
                 } else {
-                    args += portp->vlArgType(true, false, true);
+                    // DPI import wrappers only read their inputs, so pass arrays by
+                    // reference rather than copying them on each call
+                    const bool asRef = nodep->dpiImportWrapper()
+                                       && VN_IS(portp->dtypep()->skipRefp(), UnpackArrayDType);
+                    args += portp->vlArgType(true, false, true, "", asRef);
                 }
             }
         }
@@ -587,6 +587,18 @@ void EmitCFunc::emitVarReset(AstVar* varp, bool constructing) {
     }
 }
 
+static bool varResetZero(const AstVar* varp, const AstBasicDType* basicp) {
+    // Return if reset to zero, rather than randomize
+    return (varp->attrFileDescr()  // Zero so we don't do file IO if never $fopen
+            || varp->isFuncLocal()  // Randomization too slow
+            || (basicp && basicp->isZeroInit())
+            || (v3Global.opt.underlineZero() && !varp->name().empty() && varp->name()[0] == '_')
+            || (varp->varType().isTemp() && !varp->isXTemp())
+            || (varp->isXTemp()
+                    ? (v3Global.opt.xAssign() != "unique")
+                    : (v3Global.opt.xInitial() == "fast" || v3Global.opt.xInitial() == "0")));
+}
+
 string EmitCFunc::emitVarResetRecurse(const AstVar* varp, bool constructing,
                                       const string& varNameProtected, AstNodeDType* dtypep,
                                       int depth, const string& suffix) {
@@ -632,6 +644,8 @@ string EmitCFunc::emitVarResetRecurse(const AstVar* varp, bool constructing,
     } else if (const AstUnpackArrayDType* const adtypep = VN_CAST(dtypep, UnpackArrayDType)) {
         UASSERT_OBJ(adtypep->hi() >= adtypep->lo(), varp,
                     "Should have swapped msb & lsb earlier.");
+        const string bulk = emitVarResetBulk(varp, varNameProtected + suffix, dtypep);
+        if (!bulk.empty()) return bulk;
         const string ivar = "__Vi"s + cvtToStr(depth);
         const string pre = ("for (int " + ivar + " = " + cvtToStr(0) + "; " + ivar + " < "
                             + cvtToStr(adtypep->elementsConst()) + "; ++" + ivar + ") {\n");
@@ -667,15 +681,7 @@ string EmitCFunc::emitVarResetRecurse(const AstVar* varp, bool constructing,
     } else if (basicp && (basicp->isRandomGenerator() || basicp->isStdRandomGenerator())) {
         return "";
     } else if (basicp) {
-        const bool zeroit
-            = (varp->attrFileDescr()  // Zero so we don't do file IO if never $fopen
-               || varp->isFuncLocal()  // Randomization too slow
-               || (basicp && basicp->isZeroInit())
-               || (v3Global.opt.underlineZero() && !varp->name().empty() && varp->name()[0] == '_')
-               || (varp->varType().isTemp() && !varp->isXTemp())
-               || (varp->isXTemp()
-                       ? (v3Global.opt.xAssign() != "unique")
-                       : (v3Global.opt.xInitial() == "fast" || v3Global.opt.xInitial() == "0")));
+        const bool zeroit = varResetZero(varp, basicp);
         const bool slow = !varp->isFuncLocal() && !varp->isClassMember();
         splitSizeInc(1);
         if (dtypep->isWide()) {  // Handle unpacked; not basicp->isWide
@@ -727,6 +733,35 @@ string EmitCFunc::emitVarResetRecurse(const AstVar* varp, bool constructing,
     return "";
 }
 
+string EmitCFunc::emitVarResetBulk(const AstVar* varp, const string& varNameSuffixed,
+                                   AstNodeDType* dtypep) {
+    // Randomize an unpacked array of packed elements with one call over its
+    // storage, rather than a loop per dimension calling the PRNG per element.
+    // Returns empty if the element loops are needed.
+    if (varp->valuep() || varp->isXTemp()) return "";
+    string firstElement = varNameSuffixed;
+    uint64_t elements = 1;
+    while (const AstUnpackArrayDType* const adtypep = VN_CAST(dtypep, UnpackArrayDType)) {
+        // Nested VlUnpacked are contiguous, so the first element addresses all
+        elements *= adtypep->elementsConst();
+        firstElement += "[0]";
+        dtypep = adtypep->subDTypep()->skipRefp();
+    }
+    if (!VN_IS(dtypep, BasicDType) && !VN_IS(dtypep, PackArrayDType)) return "";
+    const AstBasicDType* const basicp = dtypep->basicp();
+    if (!basicp || basicp->isOpaque() || !dtypep->isIntegralOrPacked()) return "";
+    if (dtypep->width() != dtypep->widthMin()) return "";
+    if (varResetZero(varp, basicp)) return "";
+    if (dtypep->isWide()) firstElement += "[0]";
+    splitSizeInc(1);
+    emitVarResetScopeHash();
+    const uint64_t salt = VString::hashMurmur(varp->prettyName());
+    return "VL_SCOPED_RAND_RESET_ARRAY_"s + dtypep->charIQWN() + "("
+           + cvtToStr(dtypep->widthMin()) + ", &" + firstElement + ", " + cvtToStr(elements)
+           + ", " + (m_classOrPackage ? m_classOrPackageHash : "__VscopeHash") + ", "
+           + std::to_string(salt) + "ull);\n";
+}
+
 void EmitCFunc::emitVarResetScopeHash() {
     if (VL_LIKELY(m_createdScopeHash)) { return; }
     if (m_classOrPackage) {
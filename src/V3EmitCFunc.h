@@ -216,6 +216,8 @@ public:
     string emitVarResetRecurse(const AstVar* varp, bool constructing,
                                const string& varNameProtected, AstNodeDType* dtypep, int depth,
                                const string& suffix);
+    string emitVarResetBulk(const AstVar* varp, const string& varNameSuffixed,
+                            AstNodeDType* dtypep);
     void emitVarResetScopeHash();
     void emitChangeDet();
     void emitConstInit(AstNode* initp) { iterateConst(initp); }
@@ -766,68 +768,87 @@ public:
         }
         iterateChildrenConst(nodep);
     }
-    void visit(AstCoverOtherDecl* nodep) override {
-        putns(nodep, "vlSelf->__vlCoverInsert(");  // As Declared in emitCoverageDecl
-        puts("&(vlSymsp->__Vcoverage[");
-        puts(cvtToStr(nodep->dataDeclThisp()->binNum()));
-        puts("])");
+    void visit(AstNodeCoverDecl* nodep) override {
+        // Consecutive declarations are emitted together, as one constant table
+        // inserted with a single call, by the first declaration
+        if (VN_IS(nodep->backp(), NodeCoverDecl) && nodep->backp()->nextp() == nodep) return;
+        std::map<std::string, uint32_t> strIndexes;  // String pool indices
+        std::vector<std::string> strs;  // String pool
+        const auto strIndex = [&](const std::string& str) -> uint32_t {
+            const auto pair = strIndexes.emplace(str, strs.size());
+            if (pair.second) strs.push_back(str);
+            return pair.first->second;
+        };
+        strIndex("");  // Index 0 is empty, e.g. for no linescov
+        std::string rows;
+        size_t npoints = 0;
+        for (AstNode* np = nodep; np; np = np->nextp()) {
+            AstNodeCoverDecl* const declp = VN_CAST(np, NodeCoverDecl);
+            if (!declp) break;
+            const AstCoverOtherDecl* const otherp = VN_CAST(declp, CoverOtherDecl);
+            const AstCoverToggleDecl* const togglep = VN_CAST(declp, CoverToggleDecl);
+            const int column = declp->fileline()->firstColumn() + (otherp ? otherp->offset() : 0);
+            std::string type = "OTHER";
+            int begin = 0;
+            int end = 0;
+            if (togglep) {
+                type = togglep->range().ranged() ? "TOGGLE_RANGED" : "TOGGLE";
+                begin = togglep->range().right();
+                end = togglep->range().left();
+            }
+            rows += "{" + cvtToStr(declp->dataDeclThisp()->binNum());
+            rows += ", VerilatedCovPointInfo::" + type;
+            rows += ", " + cvtToStr(strIndex(protect(declp->fileline()->filename())));
+            rows += ", " + cvtToStr(declp->fileline()->lineno());
+            rows += ", " + cvtToStr(column);
+            rows += ", "
+                    + cvtToStr(strIndex(
+                        (!declp->hier().empty() ? "." : "")
+                        + VIdProtect::protectWordsIf(declp->hier(), declp->protect())));
+            rows += ", "
+                    + cvtToStr(
+                        strIndex(VIdProtect::protectWordsIf(declp->page(), declp->protect())));
+            rows += ", "
+                    + cvtToStr(
+                        strIndex(VIdProtect::protectWordsIf(declp->comment(), declp->protect())));
+            rows += ", " + cvtToStr(strIndex(otherp ? otherp->linescov() : ""));
+            rows += ", " + cvtToStr(begin) + ", " + cvtToStr(end) + "},\n";
+            ++npoints;
+        }
+        putns(nodep, "{\n");
+        puts("static const char* const __Vcovstrs[] = {\n");
+        for (const std::string& str : strs) {
+            putsQuoted(str);
+            puts(",\n");
+        }
+        puts("};\n");
+        puts("static const VerilatedCovPointInfo __Vcovinfo[] = {\n");
+        puts(rows);
+        puts("};\n");
         // If this isn't the first instantiation of this module under this
         // design, don't really count the bucket, and rely on verilator_cov to
         // aggregate counts.  This is because Verilator combines all
         // hierarchies itself, and if verilator_cov also did it, you'd end up
         // with (number-of-instant) times too many counts in this bin.
-        puts(", first");  // Enable, passed from __Vconfigure parameter
-        puts(", ");
-        putsQuoted(protect(nodep->fileline()->filename()));
-        puts(", ");
-        puts(cvtToStr(nodep->fileline()->lineno()));
-        puts(", ");
-        puts(cvtToStr(nodep->offset() + nodep->fileline()->firstColumn()));
-        puts(", ");
-        putsQuoted((!nodep->hier().empty() ? "." : "")
-                   + VIdProtect::protectWordsIf(nodep->hier(), nodep->protect()));
-        puts(", ");
-        putsQuoted(VIdProtect::protectWordsIf(nodep->page(), nodep->protect()));
-        puts(", ");
-        putsQuoted(VIdProtect::protectWordsIf(nodep->comment(), nodep->protect()));
-        puts(", ");
-        putsQuoted(nodep->linescov());
-        puts(");\n");
-    }
-    void visit(AstCoverToggleDecl* nodep) override {
-        putns(nodep, "vlSelf->__vlCoverToggleInsert(");  // As Declared in emitCoverageDecl
-        puts(cvtToStr(nodep->range().right()));
-        puts(", ");
-        puts(cvtToStr(nodep->range().left()));
-        puts(", ");
-        puts(cvtToStr(nodep->range().ranged()));
+        puts("vlSymsp->_vm_contextp__->coveragep()->_insertTable(vlSelf->vlNamep, ");
+        if (v3Global.opt.threads() > 1) {
+            puts("reinterpret_cast<uint32_t*>(vlSymsp->__Vcoverage)");
+        } else {
+            puts("vlSymsp->__Vcoverage");
+        }
         puts(", ");
-        puts("&(vlSymsp->__Vcoverage[");
-        puts(cvtToStr(nodep->dataDeclThisp()->binNum()));
-        puts("])");
-        // If this isn't the first instantiation of this module under this
-        // design, don't really count the bucket, and rely on verilator_cov to
-        // aggregate counts.  This is because Verilator combines all
-        // hierarchies itself, and if verilator_cov also did it, you'd end up
-        // with (number-of-instant) times too many counts in this bin.
+        puts(v3Global.opt.coverageHitOnly() ? "true" : "false");
         puts(", first");  // Enable, passed from __Vconfigure parameter
-        puts(", ");
-        putsQuoted(protect(nodep->fileline()->filename()));
-        puts(", ");
-        puts(cvtToStr(nodep->fileline()->lineno()));
-        puts(", ");
-        puts(cvtToStr(nodep->fileline()->firstColumn()));
-        puts(", ");
-        putsQuoted((!nodep->hier().empty() ? "." : "")
-                   + VIdProtect::protectWordsIf(nodep->hier(), nodep->protect()));
-        puts(", ");
-        putsQuoted(VIdProtect::protectWordsIf(nodep->page(), nodep->protect()));
-        puts(", ");
-        putsQuoted(VIdProtect::protectWordsIf(nodep->comment(), nodep->protect()));
-        puts(");\n");
+        puts(", __Vcovstrs, __Vcovinfo, " + cvtToStr(npoints) + ");\n");
+        puts("}\n");
     }
     void visit(AstCoverInc* nodep) override {
-        if (VN_IS(nodep->declp(), CoverOtherDecl)) {
+        if (VN_IS(nodep->declp(), CoverOtherDecl) && v3Global.opt.coverageHitOnly()) {
+            putns(nodep, v3Global.opt.threads() > 1 ? "VL_COV_HIT_MT(" : "VL_COV_HIT_ST(");
+            puts("vlSymsp->__Vcoverage, ");
+            puts(cvtToStr(nodep->declp()->dataDeclThisp()->binNum()));
+            puts(");\n");
+        } else if (VN_IS(nodep->declp(), CoverOtherDecl)) {
             if (v3Global.opt.threads() > 1) {
                 putns(nodep, "vlSymsp->__Vcoverage[");
                 puts(cvtToStr(nodep->declp()->dataDeclThisp()->binNum()));
@@ -838,7 +859,7 @@ public:
                 puts("]);\n");
             }
         } else {
-            puts("VL_COV_TOGGLE_CHG_");
+            puts(v3Global.opt.coverageHitOnly() ? "VL_COV_TOGGLE_HIT_" : "VL_COV_TOGGLE_CHG_");
             if (v3Global.opt.threads() > 1) {
                 puts("MT_");
             } else {
@@ -850,7 +871,11 @@ public:
             // coverpoint
             puts(cvtToStr(nodep->declp()->size() / 2));
             puts(", ");
-            puts("vlSymsp->__Vcoverage + ");
+            if (v3Global.opt.coverageHitOnly()) {
+                puts("vlSymsp->__Vcoverage, ");
+            } else {
+                puts("vlSymsp->__Vcoverage + ");
+            }
             puts(cvtToStr(nodep->declp()->dataDeclThisp()->binNum()));
             puts(", ");
             iterateConst(nodep->toggleExprp());
@@ -185,23 +185,6 @@ class EmitCHeader final : public EmitCConstInit {
             puts("void " + protect("__Vconfigure") + "(bool first);\n");
         }
 
-        if (v3Global.opt.coverage() && !VN_IS(modp, Class)) {
-            decorateFirst(first, section);
-            puts("void __vlCoverInsert(");
-            puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
-            puts("* countp, bool enable, const char* filenamep, int lineno, int column,\n");
-            puts("const char* hierp, const char* pagep, const char* commentp, const char* "
-                 "linescovp);\n");
-        }
-
-        if (v3Global.opt.coverageToggle() && !VN_IS(modp, Class)) {
-            decorateFirst(first, section);
-            puts("void __vlCoverToggleInsert(int begin, int end, bool ranged, ");
-            puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
-            puts("* countp, bool enable, const char* filenamep, int lineno, int column,\n");
-            puts("const char* hierp, const char* pagep, const char* commentp);\n");
-        }
-
         if (v3Global.opt.savable()) {
             decorateFirst(first, section);
             puts("void " + protect("__Vserialize") + "(VerilatedSerialize& os);\n");
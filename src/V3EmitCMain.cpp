@@ -39,6 +39,9 @@ public:
     EmitCMain() { emitInt(); }
 
 private:
+    // Report coroutine frame memory, since Verilated with --stats
+    static bool framePoolStats() { return v3Global.opt.stats() && v3Global.usesTiming(); }
+
     // MAIN METHOD
     void emitInt() {
         // Not defining main_time/vl_time_stamp, so
@@ -56,6 +59,7 @@ private:
 
         puts("#include \"verilated.h\"\n");
         puts("#include \"" + EmitCUtil::topClassName() + ".h\"\n");
+        if (framePoolStats()) puts("#include \"verilated_timing.h\"\n");
         if (v3Global.opt.debugRuntimeTimeout()) {
             puts("\n");
             puts("#include <csignal>\n");
@@ -126,6 +130,9 @@ private:
 
         puts("// Print statistical summary report\n");
         puts("contextp->statsPrintSummary();\n");
+        if (framePoolStats()) {
+            puts("if (!contextp->quiet()) VlCoroutineFramePool::statsPrint();\n");
+        }
         puts("\n");
 
         puts("return 0;\n");
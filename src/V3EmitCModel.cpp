@@ -430,6 +430,7 @@ class EmitCModel final : public EmitCFunc {
         puts(topModNameProtected + "__" + protect("_eval") + "(&(vlSymsp->TOP));\n");
 
         putsDecoration(nullptr, "// Evaluate cleanup\n");
+        if (v3Global.hasDpiDeferred()) puts("vlSymsp->__Vm_dpiDeferred.dispatch();\n");
         puts("Verilated::endOfEval(vlSymsp->__Vm_evalMsgQp);\n");
 
         puts("}\n");
@@ -490,6 +491,7 @@ class EmitCModel final : public EmitCFunc {
         // ::final
         puts("\nVL_ATTR_COLD void " + EmitCUtil::topClassName() + "::final() {\n");
         puts(/**/ topModNameProtected + "__" + protect("_eval_final") + "(&(vlSymsp->TOP));\n");
+        if (v3Global.hasDpiDeferred()) puts("vlSymsp->__Vm_dpiDeferred.flush();\n");
         puts("}\n");
 
         putSectionDelimiter("Implementations of abstract methods from VerilatedModel\n");
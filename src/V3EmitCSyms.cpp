@@ -22,9 +22,11 @@
 #include "V3LanguageWords.h"
 #include "V3StackCount.h"
 #include "V3Stats.h"
+#include "V3VpiChange.h"
 
 #include <algorithm>
 #include <map>
+#include <set>
 #include <vector>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
@@ -91,9 +93,11 @@ class EmitCSyms final : EmitCBaseVisitorConst {
     AstNodeModule* m_modp = nullptr;  // Current module
     std::vector<ScopeModPair> m_scopes;  // Every scope by module
     std::vector<AstCFunc*> m_dpis;  // DPI functions
+    std::map<const std::string, const AstCFunc*> m_dpiDirects;  // --dpi-export-direct by cname
     std::vector<ModVarPair> m_modVars;  // Each public {mod,var}
     std::map<const std::string, ScopeFuncData> m_scopeFuncs;  // Each {scope,dpi-export-func}
     std::map<const std::string, ScopeVarData> m_scopeVars;  // Each {scope,public-var}
+    std::set<std::pair<const AstNodeModule*, std::string>> m_vpiDirtyVars;  // Each {mod,var}
     ScopeNames m_scopeNames;  // Each unique AstScopeName. Dpi scopes added later
     ScopeNames m_dpiScopeNames;  // Each unique AstScopeName for DPI export
     ScopeNames m_vpiScopeCandidates;  // All scopes for VPI
@@ -111,6 +115,10 @@ class EmitCSyms final : EmitCBaseVisitorConst {
     void emitSymImp(const AstNetlist* netlistp);
     void emitDpiHdr();
     void emitDpiImp();
+    string dpiDirectName(const ScopeFuncData& sfd) const;
+    string dpiDirectArgs(const AstCFunc* funcp) const;
+    void emitDpiDirectHdr();
+    void emitDpiDirectImp();
 
     void emitSplit(std::vector<std::string>& stmts, const std::string& name, size_t max_stmts);
 
@@ -304,6 +312,10 @@ class EmitCSyms final : EmitCBaseVisitorConst {
             emitDpiHdr();
             if (!m_dpiHdrOnly) emitDpiImp();
         }
+        if (!m_dpiDirects.empty()) {
+            emitDpiDirectHdr();
+            if (!m_dpiHdrOnly) emitDpiDirectImp();
+        }
     }
     void visit(AstConstPool* nodep) override {}  // Ignore
     void visit(AstNodeModule* nodep) override {
@@ -378,6 +390,11 @@ class EmitCSyms final : EmitCBaseVisitorConst {
         if ((nodep->isSigUserRdPublic() || nodep->isSigUserRWPublic()) && !m_cfuncp) {
             m_modVars.emplace_back(m_modp, nodep);
         }
+        // Record public variables with a --vpi-change-hooks dirty flag
+        const std::string dirtyPrefix = V3VpiChange::DIRTY_PREFIX;
+        if (VString::startsWith(nodep->name(), dirtyPrefix) && !m_cfuncp) {
+            m_vpiDirtyVars.emplace(m_modp, nodep->name().substr(dirtyPrefix.size()));
+        }
     }
     void visit(AstNodeCoverDecl* nodep) override {
         // Assign numbers to all bins, so we know how big of an array to use
@@ -389,6 +406,7 @@ class EmitCSyms final : EmitCBaseVisitorConst {
     void visit(AstCFunc* nodep) override {
         nameCheck(nodep);
         if (nodep->dpiImportPrototype() || nodep->dpiExportDispatcher()) m_dpis.push_back(nodep);
+        if (nodep->dpiExportDirect()) m_dpiDirects.emplace(nodep->cname(), nodep);
         VL_RESTORER(m_cfuncp);
         m_cfuncp = nodep;
         iterateChildrenConst(nodep);
@@ -478,6 +496,11 @@ void EmitCSyms::emitSymHdr() {
         }
     }
     if (v3Global.hasClasses()) puts("VlDeleter __Vm_deleter;\n");
+    if (v3Global.hasDpiDeferred()) {
+        // Asynchronous when multithreaded, so the calls overlap the next eval
+        puts("VlDpiDeferred __Vm_dpiDeferred{"s + (v3Global.opt.threads() > 1 ? "true" : "false")
+             + "};\n");
+    }
     puts("bool __Vm_didInit = false;\n");
 
     if (v3Global.opt.mtasks()) {
@@ -512,7 +535,9 @@ void EmitCSyms::emitSymHdr() {
         puts("\n// COVERAGE\n");
         puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
         puts(" __Vcoverage[");
-        puts(std::to_string(m_coverBins));
+        // With --coverage-hit-only, one bit per bin
+        puts(std::to_string(v3Global.opt.coverageHitOnly() ? (m_coverBins + 31) / 32
+                                                           : m_coverBins));
         puts("];\n");
     }
 
@@ -712,7 +737,7 @@ std::vector<std::string> EmitCSyms::getSymCtorStmts() {
     for (const ScopeModPair& i : m_scopes) {
         const AstScope* const scopep = i.first;
         AstNodeModule* const modp = i.second;
-        // first is used by AstCoverDecl's call to __vlCoverInsert
+        // first is used by AstCoverDecl's call to _insertTable
         const bool first = !modp->user1();
         modp->user1(true);
         add(VIdProtect::protectIf(scopep->nameDotless(), scopep->protect()) + "."
@@ -835,6 +860,14 @@ std::vector<std::string> EmitCSyms::getSymCtorStmts() {
             stmt += bounds;
             stmt += ");";
             add(stmt);
+
+            if (m_vpiDirtyVars.count(std::make_pair(svd.m_modp, varp->name()))) {
+                stmt = protect("__Vscopep_" + svd.m_scopeName) + "->varDirtyInsert(\"";
+                stmt += V3OutFormatter::quoteNameControls(protect(svd.m_varBasePretty));
+                stmt += "\", &(" + VIdProtect::protectIf(scopep->nameDotless(), scopep->protect());
+                stmt += "." + protect(V3VpiChange::DIRTY_PREFIX + varp->name()) + "));";
+                add(stmt);
+            }
         }
     }
 
@@ -1142,6 +1175,108 @@ void EmitCSyms::emitDpiImp() {
     closeOutputFile();
 }
 
+//######################################################################
+
+string EmitCSyms::dpiDirectName(const ScopeFuncData& sfd) const {
+    return topClassName() + "__dpix__" + sfd.m_scopep->scopeSymName() + "__"
+           + sfd.m_cfuncp->cname();
+}
+
+string EmitCSyms::dpiDirectArgs(const AstCFunc* funcp) const {
+    // Model, then the DPI export's arguments
+    string args = topClassName() + "* modelp";
+    for (const AstNode* stmtp = funcp->argsp(); stmtp; stmtp = stmtp->nextp()) {
+        if (const AstVar* const portp = VN_CAST(stmtp, Var)) {
+            if (portp->isIO() && !portp->isFuncReturn()) {
+                args += ", " + portp->dpiArgType(true, false);
+            }
+        }
+    }
+    return args;
+}
+
+void EmitCSyms::emitDpiDirectHdr() {
+    UINFO(6, __FUNCTION__ << ": ");
+
+    openNewOutputHeaderFile(topClassName() + "__Dpi_Direct",
+                            "Direct entry points for DPI export functions.");
+    puts("//\n");
+    puts("// Include this file in C++ code that calls DPI exports in a known scope.\n");
+    puts("// Each entry point sets the DPI scope and calls the export in that scope\n");
+    puts("// of the given model, without the scope lookup of the DPI export function.\n");
+
+    ofp()->putsGuard();
+
+    puts("\n");
+    puts("#include \"svdpi.h\"\n");
+    puts("\n");
+    puts("class " + topClassName() + ";\n");
+    puts("\n");
+
+    for (const auto& itpair : m_scopeFuncs) {
+        const ScopeFuncData& sfd = itpair.second;
+        if (!sfd.m_cfuncp->dpiExportImpl()) continue;
+        const auto it = m_dpiDirects.find(sfd.m_cfuncp->cname());
+        if (it == m_dpiDirects.end()) continue;
+        const AstCFunc* const funcp = it->second;
+        putsDecoration(funcp, "// DPI export '" + funcp->cname() + "' in scope '"
+                                  + sfd.m_scopep->scopePrettySymName() + "'\n");
+        putns(funcp, "extern " + funcp->rtnTypeVoid() + " " + dpiDirectName(sfd) + "("
+                         + dpiDirectArgs(funcp) + ");\n");
+    }
+
+    ofp()->putsEndGuard();
+
+    closeOutputFile();
+}
+
+void EmitCSyms::emitDpiDirectImp() {
+    UINFO(6, __FUNCTION__ << ": ");
+    openNewOutputSourceFile(topClassName() + "__Dpi_Direct", false, false,
+                            "Implementation of direct entry points for DPI export functions");
+    puts("\n");
+    puts("#include \"" + topClassName() + "__Dpi_Direct.h\"\n");
+    puts("#include \"" + topClassName() + ".h\"\n");
+    puts("#include \"" + symClassName() + ".h\"\n");
+    puts("\n");
+
+    // Declarations for the dispatchers and DPI Export implementation functions
+    const AstNodeModule* const rootModp = v3Global.rootp()->topModulep();
+    for (const auto& itpair : m_dpiDirects) emitCFuncDecl(itpair.second, rootModp);
+    for (const auto& itpair : m_scopeFuncs) {
+        const ScopeFuncData& sfd = itpair.second;
+        if (!sfd.m_cfuncp->dpiExportImpl()) continue;
+        if (!m_dpiDirects.count(sfd.m_cfuncp->cname())) continue;
+        emitCFuncDecl(sfd.m_cfuncp, sfd.m_modp);
+    }
+
+    for (const auto& itpair : m_scopeFuncs) {
+        const ScopeFuncData& sfd = itpair.second;
+        if (!sfd.m_cfuncp->dpiExportImpl()) continue;
+        const auto it = m_dpiDirects.find(sfd.m_cfuncp->cname());
+        if (it == m_dpiDirects.end()) continue;
+        const AstCFunc* const funcp = it->second;
+        puts("\n");
+        putns(funcp, funcp->rtnTypeVoid() + " " + dpiDirectName(sfd) + "("
+                         + dpiDirectArgs(funcp) + ") {\n");
+        puts(symClassName() + "* const vlSymsp = modelp->rootp->vlSymsp;\n");
+        // As svSetScope() would, so DPI code called by the export sees this scope
+        const std::string scopeVar = protect("__Vscopep_" + sfd.m_scopep->scopeSymName());
+        puts("Verilated::dpiScope(vlSymsp->" + scopeVar + ");\n");
+        putns(funcp, "return " + funcNameProtect(funcp, rootModp) + "(vlSymsp, ");
+        puts("(void*)(&" + EmitCUtil::prefixNameProtect(sfd.m_modp) + "__"
+             + sfd.m_cfuncp->nameProtect() + ")");
+        for (const AstNode* stmtp = funcp->argsp(); stmtp; stmtp = stmtp->nextp()) {
+            if (const AstVar* const portp = VN_CAST(stmtp, Var)) {
+                if (portp->isIO() && !portp->isFuncReturn()) putns(portp, ", " + portp->name());
+            }
+        }
+        puts(");\n");
+        puts("}\n");
+    }
+    closeOutputFile();
+}
+
 //######################################################################
 // EmitC class functions
 
@@ -692,6 +692,11 @@ public:
 
         of.puts("# User LDLIBS (from -LDFLAGS on Verilator command line)\n");
         of.puts("VM_USER_LDLIBS = \\\n");
+        if (v3Global.opt.hierTop() && v3Global.opt.hierDlopen()) {
+            // Hierarchical blocks' shared libraries use the executable's global objects
+            of.puts("\t-rdynamic \\\n");
+            of.puts("\t-ldl \\\n");
+        }
         const VStringList& ldLibs = v3Global.opt.ldLibs();
         for (const string& i : ldLibs) of.puts("  " + i + " \\\n");
         of.puts("\n");
@@ -752,6 +757,18 @@ public:
                     + ": $(VK_USER_OBJS) $(VK_GLOBAL_OBJS) $(VM_PREFIX)__ALL.a\n");
             of.puts("\t$(LINK) $(LDFLAGS) $^ $(LOADLIBES) $(LDLIBS) $(LIBS) $(SC_LIBS) -o $@\n");
             of.puts("\n");
+        } else if (!v3Global.opt.libCreate().empty() && v3Global.opt.hierChild()
+                   && v3Global.opt.hierDlopen()) {
+            of.puts("\n### Library rules from --lib-create with --hierarchical-dlopen\n");
+            // The archive only has the loader, so the executable links without the model.
+            // The model is in the .so, without the global objects, which the executable has.
+            of.puts(v3Global.opt.libCreateName(false) + ": " + v3Global.opt.libCreate()
+                    + "__Dlopen.o\n");
+            of.puts("\n");
+            emitSharedLibRule(of, "$(VK_OBJS) $(VK_USER_OBJS) " + v3Global.opt.libCreate()
+                                      + ".o $(VM_HIER_LIBS)");
+            of.puts("lib" + v3Global.opt.libCreate() + ": " + v3Global.opt.libCreateName(false)
+                    + " " + v3Global.opt.libCreateName(true) + "\n");
         } else if (!v3Global.opt.libCreate().empty()) {
             const string libCreateDeps = "$(VK_OBJS) $(VK_USER_OBJS) $(VK_GLOBAL_OBJS) "
                                          + v3Global.opt.libCreate() + ".o $(VM_HIER_LIBS)";
@@ -764,18 +781,7 @@ public:
                 of.puts("lib" + v3Global.opt.libCreate() + ": " + v3Global.opt.libCreateName(false)
                         + "\n");
             } else {
-                of.puts(v3Global.opt.libCreateName(true) + ": " + libCreateDeps + "\n");
-                // Linker on mac emits an error if all symbols are not found here,
-                // but some symbols that are referred as "DPI-C" can not be found at this moment.
-                // So add dynamic_lookup
-                of.puts("ifeq ($(shell uname -s),Darwin)\n");
-                of.puts("\t$(OBJCACHE) $(CXX) $(CXXFLAGS) $(CPPFLAGS) $(OPT_FAST) -undefined "
-                        "dynamic_lookup -shared $(LDFLAGS) -flat_namespace -o $@ $^ $(LIBS)\n");
-                of.puts("else\n");
-                of.puts("\t$(OBJCACHE) $(CXX) $(CXXFLAGS) $(CPPFLAGS) $(OPT_FAST) -shared "
-                        "$(LDFLAGS) -o $@ $^ $(LIBS)\n");
-                of.puts("endif\n");
-                of.puts("\n");
+                emitSharedLibRule(of, libCreateDeps);
                 of.puts("lib" + v3Global.opt.libCreate() + ": " + v3Global.opt.libCreateName(false)
                         + " " + v3Global.opt.libCreateName(true) + "\n");
             }
@@ -793,6 +799,21 @@ public:
         of.putsHeader();
     }
 
+    static void emitSharedLibRule(V3OutMkFile& of, const string& deps) {
+        of.puts(v3Global.opt.libCreateName(true) + ": " + deps + "\n");
+        // Linker on mac emits an error if all symbols are not found here,
+        // but some symbols that are referred as "DPI-C" can not be found at this moment.
+        // So add dynamic_lookup
+        of.puts("ifeq ($(shell uname -s),Darwin)\n");
+        of.puts("\t$(OBJCACHE) $(CXX) $(CXXFLAGS) $(CPPFLAGS) $(OPT_FAST) -undefined "
+                "dynamic_lookup -shared $(LDFLAGS) -flat_namespace -o $@ $^ $(LIBS)\n");
+        of.puts("else\n");
+        of.puts("\t$(OBJCACHE) $(CXX) $(CXXFLAGS) $(CPPFLAGS) $(OPT_FAST) -shared "
+                "$(LDFLAGS) -o $@ $^ $(LIBS)\n");
+        of.puts("endif\n");
+        of.puts("\n");
+    }
+
     explicit EmitMk() {
         emitClassMake();
         emitOverallMake();
@@ -840,6 +861,12 @@ class EmitMkHierVerilation final {
 
         of.puts(".SUFFIXES:\n");
         of.puts(".PHONY: hier_build hier_verilation hier_launch_verilator\n");
+        if (v3Global.opt.hierDlopen()) {
+            // Unchanged outputs keep their timestamps, so always run each block's makefile,
+            // which relinks only the shared objects whose sources changed
+            of.puts(".PHONY: hier_dlopen_force\n");
+            of.puts("hier_dlopen_force:\n");
+        }
 
         of.puts("# Libraries of hierarchical blocks\n");
         of.puts("VM_HIER_LIBS := \\\n");
@@ -898,6 +925,7 @@ class EmitMkHierVerilation final {
             of.puts(": ");
             of.puts(blockp->hierMkFilename(true));
             of.puts(" ");
+            if (v3Global.opt.hierDlopen()) of.puts("hier_dlopen_force ");
             for (const V3GraphEdge& edge : blockp->outEdges()) {
                 const V3HierBlock* const dependencyp = edge.top()->as<V3HierBlock>();
                 of.puts(dependencyp->hierLibFilename(true));
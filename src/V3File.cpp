@@ -25,6 +25,7 @@
 #include <cstdarg>
 #include <fcntl.h>
 #include <iomanip>
+#include <iterator>
 #include <map>
 #include <memory>
 
@@ -986,9 +987,17 @@ V3OutFile::V3OutFile(const string& filename, V3OutFormatter::Language lang)
     : V3OutFormatter{lang}
     , m_filename{filename}
     , m_bufferp{new std::array<char, WRITE_BUFFER_SIZE_BYTES>{}} {
-    if ((m_fp = V3File::new_fopen_w(filename)) == nullptr) {
-        v3fatal("Can't write file: " << filename);
+    if (v3Global.opt.hierDlopen()) {
+        // Write to a temporary, so an unchanged file keeps its timestamp and make does not
+        // rebuild what depends on it, e.g. the top when only one block's library changed
+        m_tmpFilename = filename + "__Vtmp";
+        V3File::createMakeDirFor(filename);
+        V3File::addTgtDepend(filename);
+        m_fp = std::fopen(m_tmpFilename.c_str(), "w");
+    } else {
+        m_fp = V3File::new_fopen_w(filename);
     }
+    if (!m_fp) v3fatal("Can't write file: " << filename);
 }
 
 V3OutFile::~V3OutFile() {
@@ -996,6 +1005,26 @@ V3OutFile::~V3OutFile() {
 
     if (m_fp) fclose(m_fp);
     m_fp = nullptr;
+    if (!m_tmpFilename.empty()) replaceIfChanged();
+}
+
+void V3OutFile::replaceIfChanged() {
+    bool same = false;
+    {
+        std::ifstream oldfs{m_filename, std::ios::binary};
+        std::ifstream newfs{m_tmpFilename, std::ios::binary};
+        if (oldfs && newfs) {
+            same = std::equal(std::istreambuf_iterator<char>{oldfs},
+                              std::istreambuf_iterator<char>{},
+                              std::istreambuf_iterator<char>{newfs},
+                              std::istreambuf_iterator<char>{});
+        }
+    }
+    if (same) {
+        std::remove(m_tmpFilename.c_str());
+    } else if (std::rename(m_tmpFilename.c_str(), m_filename.c_str()) != 0) {
+        v3fatal("Can't write file: " << m_filename);
+    }
 }
 
 void V3OutFile::putsForceIncs() {
@@ -197,11 +197,14 @@ class V3OutFile VL_NOT_FINAL : public V3OutFormatter {
 
     // MEMBERS
     const std::string m_filename;
+    std::string m_tmpFilename;  // Temporary written instead, if only replacing when changed
     FILE* m_fp = nullptr;
     std::size_t m_usedBytes = 0;  // Number of bytes stored in m_bufferp
     std::size_t m_writtenBytes = 0;  // Number of bytes written to output
     std::unique_ptr<std::array<char, WRITE_BUFFER_SIZE_BYTES>> m_bufferp;  // Write buffer
 
+    void replaceIfChanged();
+
 public:
     V3OutFile(const string& filename, V3OutFormatter::Language lang);
     V3OutFile(const V3OutFile&) = delete;
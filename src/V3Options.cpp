@@ -988,6 +988,12 @@ void V3Options::notify() VL_MT_DISABLED {
         cmdfl->v3error(
             "--hierarchical must not be set with --hierarchical-child or --hierarchical-block");
     }
+    if (m_hierDlopen && !m_hierarchical && !m_hierChild) {
+        cmdfl->v3error("--hierarchical-dlopen requires --hierarchical");
+    }
+    if (m_hierDlopen && (!m_gmake || m_makeJson)) {
+        cmdfl->v3error("--hierarchical-dlopen is only supported with --make gmake");
+    }
     if (m_hierChild) {
         if (m_hierBlocks.empty()) {
             cmdfl->v3error("--hierarchical-block must be set when --hierarchical-child is set");
@@ -1358,6 +1364,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     DECL_OPTION("-coverage", CbOnOff, [this](bool flag) { coverage(flag); });
     DECL_OPTION("-coverage-expr", OnOff, &m_coverageExpr);
     DECL_OPTION("-coverage-expr-max", Set, &m_coverageExprMax);
+    DECL_OPTION("-coverage-hit-only", OnOff, &m_coverageHitOnly);
     DECL_OPTION("-coverage-line", OnOff, &m_coverageLine);
     DECL_OPTION("-coverage-max-width", Set, &m_coverageMaxWidth);
     DECL_OPTION("-coverage-toggle", OnOff, &m_coverageToggle);
@@ -1402,6 +1409,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         m_diagnosticsSarifOutput = optp;
         m_diagnosticsSarif = true;
     });
+    DECL_OPTION("-dpi-export-direct", OnOff, &m_dpiExportDirect);
     DECL_OPTION("-dpi-hdr-only", OnOff, &m_dpiHdrOnly);
     DECL_OPTION("-dump-", CbPartialMatch, [this](const char* optp) {
         m_dumpLevel[optp] = 3;
@@ -1441,6 +1449,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     DECL_OPTION("-facyc-simp", FOnOff, &m_fAcycSimp);
     DECL_OPTION("-fassemble", FOnOff, &m_fAssemble);
     DECL_OPTION("-fcase", FOnOff, &m_fCase);
+    DECL_OPTION("-fclock-toggle", FOnOff, &m_fClockToggle);
     DECL_OPTION("-fcombine", FOnOff, &m_fCombine);
     DECL_OPTION("-fconst", FOnOff, &m_fConst);
     DECL_OPTION("-fconst-before-dfg", FOnOff, &m_fConstBeforeDfg);
@@ -1519,6 +1528,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         m_hierBlocks.emplace(opt.mangledName(), opt);
     });
     DECL_OPTION("-hierarchical-child", Set, &m_hierChild);
+    DECL_OPTION("-hierarchical-dlopen", OnOff, &m_hierDlopen);
     DECL_OPTION("-hierarchical-params-file", CbVal,
                 [this](const char* optp) { m_hierParamsFile.push_back({optp, work()}); });
 
@@ -1789,6 +1799,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         }
     });
     DECL_OPTION("-timing", OnOff, &m_timing);
+    DECL_OPTION("-timing-parallel", OnOff, &m_timingParallel);
     DECL_OPTION("-top", Set, &m_topModule);
     DECL_OPTION("-top-module", Set, &m_topModule);
     DECL_OPTION("-trace", OnOff, &m_trace);
@@ -1852,6 +1863,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         v3Global.vlExit(0);
     });
     DECL_OPTION("-vpi", OnOff, &m_vpi);
+    DECL_OPTION("-vpi-change-hooks", OnOff, &m_vpiChangeHooks);
 
     DECL_OPTION("-Wall", CbCall, []() { FileLine::globalWarnOff(V3ErrorCode::I_LINT, false); });
     DECL_OPTION("-Werror-", CbPartialMatch, [this, fl](const char* optp) {
@@ -2328,6 +2340,7 @@ void V3Options::optimize(int level) {
     m_fAcycSimp = flag;
     m_fAssemble = flag;
     m_fCase = flag;
+    m_fClockToggle = flag;
     m_fCombine = flag;
     m_fConst = flag;
     m_fConstBitOpTree = flag;
@@ -1716,7 +1716,8 @@ class DpiImportCallVisitor final : public VNVisitor {
     void visit(AstCFunc* nodep) override {
         if (!m_tracingCall) return;
         m_tracingCall = false;
-        if (nodep->dpiImportWrapper()) {
+        // Deferred imports only queue the call, which is thread safe
+        if (nodep->dpiImportWrapper() && !nodep->dpiDeferred()) {
             if (nodep->dpiPure() ? !v3Global.opt.threadsDpiPure()
                                  : !v3Global.opt.threadsDpiUnpure()) {
                 // If hierarchical DPI wrapper cost is not found or is of a 0 cost,
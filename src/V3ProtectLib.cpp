@@ -21,6 +21,7 @@
 #include "V3Control.h"
 #include "V3Hasher.h"
 #include "V3InstrCount.h"
+#include "V3Os.h"
 #include "V3String.h"
 #include "V3Task.h"
 
@@ -32,6 +33,7 @@ VL_DEFINE_DEBUG_FUNCTIONS;
 class ProtectVisitor final : public VNVisitor {
     AstVFile* m_vfilep = nullptr;  // DPI-enabled Verilog wrapper
     AstCFile* m_cfilep = nullptr;  // C implementation of DPI functions
+    AstCFile* m_dlfilep = nullptr;  // C loader of DPI functions from shared library, or nullptr
     // Verilog text blocks
     AstTextBlock* m_modPortsp = nullptr;  // Module port list
     AstTextBlock* m_comboPortsp = nullptr;  // Combo function port list
@@ -57,10 +59,27 @@ class ProtectVisitor final : public VNVisitor {
     AstTextBlock* m_cSeqClksp = nullptr;  // Sequential clock copy list
     AstTextBlock* m_cSeqOutsp = nullptr;  // Sequential output copy list
     AstTextBlock* m_cIgnoreParamsp = nullptr;  // Combo ignore parameter list
+    AstTextBlock* m_cComboUnpackp = nullptr;  // Combo packed input copy list
+    AstTextBlock* m_cComboPackp = nullptr;  // Combo packed output copy list
+    AstTextBlock* m_cSeqPackp = nullptr;  // Sequential packed output copy list
+    // C loader text blocks, with --hierarchical-dlopen
+    AstTextBlock* m_dlComboArgsp = nullptr;  // Combo function argument list
+    AstTextBlock* m_dlSeqArgsp = nullptr;  // Sequential function argument list
+    AstTextBlock* m_dlIgnoreArgsp = nullptr;  // Combo ignore argument list
     const string m_libName;
     const string m_topName;
     bool m_foundTop = false;  // Have seen the top module
     bool m_hasClk = false;  // True if the top module has sequential logic
+    // Packed data inputs and outputs are passed as one vector each, LSB first,
+    // each port starting on a word boundary so slicing is by whole words
+    std::vector<string> m_packedInNames;  // Names of packed inputs, and padding
+    int m_packedInWidth = 0;  // Width of packed inputs
+    int m_packedOutWidth = 0;  // Width of packed outputs
+    int m_packedInLsb = 0;  // LSB of next packed input
+    int m_packedOutLsb = 0;  // LSB of next packed output
+    bool m_packedInFourstate = false;  // Packed inputs need logic type
+    bool m_packedOutFourstate = false;  // Packed outputs need logic type
+    bool m_comboSkip = false;  // Skip combo evaluation if packed inputs are unchanged
 
     // VISITORS
     void visit(AstNetlist* nodep) override {
@@ -70,6 +89,11 @@ class ProtectVisitor final : public VNVisitor {
         m_cfilep
             = new AstCFile{nodep->fileline(), v3Global.opt.makeDir() + "/" + m_libName + ".cpp"};
         nodep->addFilesp(m_cfilep);
+        if (v3Global.opt.hierChild() && v3Global.opt.hierDlopen()) {
+            m_dlfilep = new AstCFile{nodep->fileline(),
+                                     v3Global.opt.makeDir() + "/" + m_libName + "__Dlopen.cpp"};
+            nodep->addFilesp(m_dlfilep);
+        }
         iterateChildren(nodep);
     }
 
@@ -80,12 +104,16 @@ class ProtectVisitor final : public VNVisitor {
             UASSERT_OBJ(!m_foundTop, nodep, "Multiple root modules");
         }
         FileLine* const fl = nodep->fileline();
-        // Need to know the existence of clk before createSvFile()
+        // Need to know the existence of clk and packed widths before createSvFile()
         m_hasClk = checkIfClockExists(nodep);
+        scanPackedPorts(nodep);
         createSvFile(fl, nodep);
         createCppFile(fl);
+        if (m_dlfilep) createDlopenArgs(fl);
 
         iterateChildren(nodep);
+        addPackedPorts(fl);
+        if (m_dlfilep) createDlopenFile(fl);
 
         // cppcheck-suppress unreadVariable
         const V3Hash hash = V3Hasher::uncachedHash(m_cfilep);
@@ -334,6 +362,10 @@ class ProtectVisitor final : public VNVisitor {
         txtp->add("class " + m_topName + "_container: public " + m_topName + " {\n");
         txtp->add("public:\n");
         txtp->add("long long m_seqnum;\n");
+        if (m_comboSkip) {
+            txtp->add("bool m_comboValid__V = false;\n");
+            txtp->add("VlWide<" + cvtToStr(VL_WORDS_I(m_packedInWidth)) + "> m_comboInputs__V;\n");
+        }
         txtp->add(m_topName + "_container(const char* scopep__V):\n");
         txtp->add(m_topName + "(scopep__V) {}\n");
         txtp->add("};\n\n");
@@ -374,9 +406,26 @@ class ProtectVisitor final : public VNVisitor {
         m_cComboInsp = new AstTextBlock{fl};
         castPtr(fl, m_cComboInsp);
         txtp->add(m_cComboInsp);
+        if (m_packedInWidth) {
+            txtp->add("VlWide<" + cvtToStr(VL_WORDS_I(m_packedInWidth)) + "> inputs__Vcvt;\n");
+            txtp->add((m_packedInFourstate ? "VL_SET_W_SVLV("s : "VL_SET_W_SVBV("s)
+                      + cvtToStr(m_packedInWidth) + ", inputs__Vcvt, inputs__V);\n");
+        }
+        if (m_comboSkip) {
+            addComment(txtp, fl, "Model is already settled if the inputs are unchanged");
+            txtp->add("if (!handlep__V->m_comboValid__V"
+                      " || inputs__Vcvt != handlep__V->m_comboInputs__V) {\n");
+            txtp->add("handlep__V->m_comboValid__V = true;\n");
+            txtp->add("handlep__V->m_comboInputs__V = inputs__Vcvt;\n");
+        }
+        m_cComboUnpackp = new AstTextBlock{fl};
+        txtp->add(m_cComboUnpackp);
         txtp->add("handlep__V->eval();\n");
+        if (m_comboSkip) txtp->add("}\n");
         m_cComboOutsp = new AstTextBlock{fl};
         txtp->add(m_cComboOutsp);
+        m_cComboPackp = createPackBlock(fl);
+        txtp->add(m_cComboPackp);
         txtp->add("return handlep__V->m_seqnum++;\n");
         txtp->add("}\n\n");
 
@@ -392,15 +441,18 @@ class ProtectVisitor final : public VNVisitor {
             txtp->add("handlep__V->eval();\n");
             m_cSeqOutsp = new AstTextBlock{fl};
             txtp->add(m_cSeqOutsp);
+            m_cSeqPackp = createPackBlock(fl);
+            txtp->add(m_cSeqPackp);
             txtp->add("return handlep__V->m_seqnum++;\n");
             txtp->add("}\n\n");
         }
 
         comboIgnoreComment(txtp, fl);
         m_cIgnoreParamsp = new AstTextBlock{
-            fl, "void " + m_libName + "_protectlib_combo_ignore(\n", ",\n", "\n)\n{ }\n\n"};
+            fl, "void " + m_libName + "_protectlib_combo_ignore(\n", ",\n", "\n) {\n"};
         m_cIgnoreParamsp->add("void* vhandlep__V");
         txtp->add(m_cIgnoreParamsp);
+        txtp->add("}\n\n");
 
         // Final
         finalComment(txtp, fl);
@@ -414,6 +466,125 @@ class ProtectVisitor final : public VNVisitor {
         m_cfilep->tblockp(txtp);
     }
 
+    AstTextBlock* createPackBlock(FileLine* fl) {
+        if (!m_packedOutWidth) return new AstTextBlock{fl};
+        return new AstTextBlock{
+            fl, "VlWide<" + cvtToStr(VL_WORDS_I(m_packedOutWidth)) + "> outputs__Vcvt{};\n", "",
+            (m_packedOutFourstate ? "VL_SET_SVLV_W("s : "VL_SET_SVBV_W("s)
+                + cvtToStr(m_packedOutWidth) + ", outputs__V, outputs__Vcvt);\n"};
+    }
+
+    void createDlopenArgs(FileLine* fl) {
+        // Argument lists, the parameter lists are cloned from the C file once complete
+        m_dlComboArgsp = new AstTextBlock{fl, "return fp__V(", ", ", ");\n}\n\n"};
+        m_dlComboArgsp->add("vhandlep__V");
+        if (m_hasClk) {
+            m_dlSeqArgsp = new AstTextBlock{fl, "return fp__V(", ", ", ");\n}\n\n"};
+            m_dlSeqArgsp->add("vhandlep__V");
+        }
+        m_dlIgnoreArgsp = new AstTextBlock{fl, "fp__V(", ", ", ");\n}\n\n"};
+        m_dlIgnoreArgsp->add("vhandlep__V");
+    }
+
+    void dlopenFuncPtr(AstTextBlock* txtp, const string& funcName) {
+        txtp->add("static const auto fp__V = reinterpret_cast<decltype(&" + funcName + ")>("
+                  + m_libName + "_protectlib_sym__V(\"" + funcName + "\"));\n");
+    }
+
+    void createDlopenFile(FileLine* fl) {
+        // Comments
+        AstTextBlock* const txtp = new AstTextBlock{fl};
+        addComment(txtp, fl, "Loader for DPI protected library of hierarchical block");
+        addComment(txtp, fl,
+                   "Each function calls the same function in lib" + m_libName
+                       + ".so, so the library can be rebuilt without relinking\n");
+
+        // Includes
+        txtp->add("#include \"svdpi.h\"\n\n");
+        txtp->add("#include <cstdio>\n");
+        txtp->add("#include <cstdlib>\n");
+        txtp->add("#include <dlfcn.h>\n");
+        txtp->add("#include <string>\n\n");
+
+        // Library, opened on the first call, which is the initial-time hash check.
+        // The absolute path where it is built, unless VERILATOR_HIER_DLOPEN_DIR gives
+        // the top --Mdir moved elsewhere, under which the block has the same directory.
+        const string libFilename
+            = V3Os::filenameRealPath(v3Global.opt.makeDir()) + "/lib" + m_libName + ".so";
+        const string libRelFilename
+            = V3Os::filenameNonDir(v3Global.opt.makeDir()) + "/lib" + m_libName + ".so";
+        const auto quoted = [](const string& str) {
+            return "\"" + VString::quoteAny(VString::quoteBackslash(str), '"', '\\') + "\"";
+        };
+        addComment(txtp, fl, "Open the library, under $VERILATOR_HIER_DLOPEN_DIR if set");
+        txtp->add("static void* " + m_libName + "_protectlib_open__V() {\n");
+        txtp->add(/**/ "const char* const dirp__V"
+                       " = std::getenv(\"VERILATOR_HIER_DLOPEN_DIR\");\n");
+        txtp->add(/**/ "if (!dirp__V || !*dirp__V) return dlopen(" + quoted(libFilename)
+                  + ", RTLD_NOW | RTLD_LOCAL);\n");
+        txtp->add(/**/ "const std::string filename__V = std::string{dirp__V} + \"/\" + "
+                  + quoted(libRelFilename) + ";\n");
+        txtp->add(/**/ "return dlopen(filename__V.c_str(), RTLD_NOW | RTLD_LOCAL);\n");
+        txtp->add("}\n\n");
+        addComment(txtp, fl, "Return function in the library, loading the library if needed");
+        txtp->add("static void* " + m_libName + "_protectlib_sym__V(const char* namep__V) {\n");
+        txtp->add(/**/ "static void* const libp__V = " + m_libName + "_protectlib_open__V();\n");
+        txtp->add(/**/ "if (!libp__V) {\n");
+        txtp->add(/****/ "fprintf(stderr, \"%%Error: cannot load " + m_libName
+                  + " library: %s\\n\", dlerror());\n");
+        txtp->add(/****/ "std::exit(EXIT_FAILURE);\n");
+        txtp->add(/**/ "}\n");
+        txtp->add(/**/ "void* const symp__V = dlsym(libp__V, namep__V);\n");
+        txtp->add(/**/ "if (!symp__V) {\n");
+        txtp->add(/****/ "fprintf(stderr, \"%%Error: cannot find %s in " + m_libName
+                  + " library\\n\", namep__V);\n");
+        txtp->add(/****/ "std::exit(EXIT_FAILURE);\n");
+        txtp->add(/**/ "}\n");
+        txtp->add(/**/ "return symp__V;\n");
+        txtp->add("}\n\n");
+
+        // Extern C
+        txtp->add("extern \"C\" {\n\n");
+
+        hashComment(txtp, fl);
+        txtp->add("void " + m_libName + "_protectlib_check_hash(int protectlib_hash__V) {\n");
+        dlopenFuncPtr(txtp, m_libName + "_protectlib_check_hash");
+        txtp->add("fp__V(protectlib_hash__V);\n");
+        txtp->add("}\n\n");
+
+        initialComment(txtp, fl);
+        txtp->add("void* " + m_libName + "_protectlib_create(const char* scopep__V) {\n");
+        dlopenFuncPtr(txtp, m_libName + "_protectlib_create");
+        txtp->add("return fp__V(scopep__V);\n");
+        txtp->add("}\n\n");
+
+        comboComment(txtp, fl);
+        txtp->add(m_cComboParamsp->cloneTree(false));
+        dlopenFuncPtr(txtp, m_libName + "_protectlib_combo_update");
+        txtp->add(m_dlComboArgsp);
+
+        if (m_hasClk) {
+            seqComment(txtp, fl);
+            txtp->add(m_cSeqParamsp->cloneTree(false));
+            dlopenFuncPtr(txtp, m_libName + "_protectlib_seq_update");
+            txtp->add(m_dlSeqArgsp);
+        }
+
+        comboIgnoreComment(txtp, fl);
+        txtp->add(m_cIgnoreParamsp->cloneTree(false));
+        dlopenFuncPtr(txtp, m_libName + "_protectlib_combo_ignore");
+        txtp->add(m_dlIgnoreArgsp);
+
+        finalComment(txtp, fl);
+        txtp->add("void " + m_libName + "_protectlib_final(void* vhandlep__V) {\n");
+        dlopenFuncPtr(txtp, m_libName + "_protectlib_final");
+        txtp->add("fp__V(vhandlep__V);\n");
+        txtp->add("}\n\n");
+
+        txtp->add("}\n");
+        m_dlfilep->tblockp(txtp);
+    }
+
     void visit(AstVar* nodep) override {
         if (!nodep->isIO()) return;
         if (nodep->direction() == VDirection::INPUT) {
@@ -447,10 +618,15 @@ class ProtectVisitor final : public VNVisitor {
         }
         m_cSeqParamsp->add(varp->dpiArgType(true, false));
         m_cSeqClksp->add(cInputConnection(varp));
+        if (m_dlSeqArgsp) m_dlSeqArgsp->add(varp->name());
     }
 
     void handleDataInput(AstVar* varp) {
         handleInput(varp);
+        if (isPackable(varp)) {
+            handlePackedInput(varp);
+            return;
+        }
         m_comboPortsp->add(varp->cloneTree(false));
         m_comboParamsp->add(varp->prettyName());
         m_comboIgnorePortsp->add(varp->cloneTree(false));
@@ -458,10 +634,39 @@ class ProtectVisitor final : public VNVisitor {
         m_cComboParamsp->add(varp->dpiArgType(true, false));
         m_cComboInsp->add(cInputConnection(varp));
         m_cIgnoreParamsp->add(varp->dpiArgType(true, false));
+        if (m_dlComboArgsp) m_dlComboArgsp->add(varp->name());
+        if (m_dlIgnoreArgsp) m_dlIgnoreArgsp->add(varp->name());
     }
 
     void handleInput(AstVar* varp) { m_modPortsp->add(varp->cloneTree(false)); }
 
+    static int packedLsb(int end) { return VL_EDATASIZE * VL_WORDS_I(end); }
+
+    void handlePackedInput(AstVar* varp) {
+        const int width = varp->width();
+        const int pad = packedLsb(m_packedInLsb) - m_packedInLsb;
+        if (pad) m_packedInNames.push_back(cvtToStr(pad) + "'b0");
+        m_packedInLsb += pad;
+        const string lsb = cvtToStr(m_packedInLsb);
+        const string bits = cvtToStr(m_packedInWidth);
+        const string args = "(" + bits + ", inputs__Vcvt, " + lsb + ", " + cvtToStr(width) + ")";
+        const string lhs = "handlep__V->" + varp->name();
+        m_packedInNames.push_back(varp->prettyName());
+        if (width <= VL_IDATASIZE) {
+            m_cComboUnpackp->add(lhs + " = VL_SEL_IWII" + args + " & VL_MASK_I(" + cvtToStr(width)
+                                 + ");\n");
+        } else if (width <= VL_QUADSIZE) {
+            m_cComboUnpackp->add(lhs + " = VL_SEL_QWII" + args + " & VL_MASK_Q(" + cvtToStr(width)
+                                 + ");\n");
+        } else {
+            m_cComboUnpackp->add("VL_SEL_WWII(" + cvtToStr(width) + ", " + bits + ", " + lhs
+                                 + ", inputs__Vcvt, " + lsb + ", " + cvtToStr(width) + ");\n");
+            m_cComboUnpackp->add(lhs + "[" + cvtToStr(VL_WORDS_I(width) - 1) + "] &= VL_MASK_E("
+                                 + cvtToStr(width) + ");\n");
+        }
+        m_packedInLsb += width;
+    }
+
     static void addLocalVariable(AstTextBlock* textp, const AstVar* varp, const char* suffix) {
         AstVar* const newVarp
             = new AstVar{varp->fileline(), VVarType::VAR, varp->name() + suffix, varp->dtypep()};
@@ -471,6 +676,10 @@ class ProtectVisitor final : public VNVisitor {
     void handleOutput(AstVar* const varp) {
         const std::string pname = varp->prettyName();
         m_modPortsp->add(varp->cloneTree(false));
+        if (isPackable(varp)) {
+            handlePackedOutput(varp);
+            return;
+        }
         m_comboPortsp->add(varp->cloneTree(false));
         m_comboParamsp->add(pname + "_combo__V");
         if (m_hasClk) {
@@ -490,11 +699,121 @@ class ProtectVisitor final : public VNVisitor {
         m_comboAssignsp->add(pname + " = " + pname + "_combo__V;\n");
         m_cComboParamsp->add(varp->dpiArgType(true, false));
         m_cComboOutsp->add(V3Task::assignInternalToDpi(varp, true, "", "", "handlep__V->") + "\n");
+        if (m_dlComboArgsp) m_dlComboArgsp->add(varp->name());
         if (m_hasClk) {
             m_cSeqParamsp->add(varp->dpiArgType(true, false));
             m_cSeqOutsp->add(V3Task::assignInternalToDpi(varp, true, "", "", "handlep__V->")
                              + "\n");
+            if (m_dlSeqArgsp) m_dlSeqArgsp->add(varp->name());
+        }
+    }
+
+    void handlePackedOutput(AstVar* varp) {
+        const std::string pname = varp->prettyName();
+        const int width = varp->width();
+        m_packedOutLsb = packedLsb(m_packedOutLsb);
+        const string range = "[" + cvtToStr(m_packedOutLsb + width - 1) + ":"
+                             + cvtToStr(m_packedOutLsb) + "]";
+        const char* const suffix
+            = width <= VL_IDATASIZE ? "WI" : width <= VL_QUADSIZE ? "WQ" : "WW";
+        const string pack = "VL_ASSIGNSEL_"s + suffix + "(" + cvtToStr(m_packedOutWidth) + ", "
+                            + cvtToStr(width) + ", " + cvtToStr(m_packedOutLsb)
+                            + ", outputs__Vcvt, handlep__V->" + varp->name() + ");\n";
+        if (m_hasClk) {
+            m_seqAssignsp->add(pname + " = seq_outputs__V" + range + ";\n");
+            m_cSeqPackp->add(pack);
+        }
+        m_comboAssignsp->add(pname + " = combo_outputs__V" + range + ";\n");
+        m_cComboPackp->add(pack);
+        m_packedOutLsb += width;
+    }
+
+    AstVar* packedVar(FileLine* fl, const string& name, int width, bool fourstate) {
+        const VNumRange range{width - 1, 0};
+        AstNodeDType* const dtypep
+            = fourstate ? m_vfilep->findLogicRangeDType(range, width, VSigning::UNSIGNED)
+                        : m_vfilep->findBitRangeDType(range, width, VSigning::UNSIGNED);
+        return new AstVar{fl, VVarType::VAR, name, dtypep};
+    }
+
+    void addPackedPorts(FileLine* fl) {
+        // Packed vectors go after all other ports of each function
+        if (m_packedInWidth) {
+            AstVar* const inp = packedVar(fl, "inputs__V", m_packedInWidth, m_packedInFourstate);
+            inp->direction(VDirection::INPUT);
+            string concat;
+            for (const string& name : m_packedInNames) {
+                concat = name + (concat.empty() ? "" : ", ") + concat;
+            }
+            concat = "{" + concat + "}";
+            m_comboPortsp->add(inp->cloneTree(false));
+            m_comboParamsp->add(concat);
+            m_comboIgnorePortsp->add(inp->cloneTree(false));
+            if (m_hasClk) m_comboIgnoreParamsp->add(concat);
+            m_cComboParamsp->add(inp->dpiArgType(true, false));
+            m_cIgnoreParamsp->add(inp->dpiArgType(true, false));
+            if (m_dlComboArgsp) m_dlComboArgsp->add(inp->name());
+            if (m_dlIgnoreArgsp) m_dlIgnoreArgsp->add(inp->name());
+            VL_DO_DANGLING(inp->deleteTree(), inp);
+        }
+        if (m_packedOutWidth) {
+            AstVar* const outp
+                = packedVar(fl, "outputs__V", m_packedOutWidth, m_packedOutFourstate);
+            outp->direction(VDirection::OUTPUT);
+            m_comboPortsp->add(outp->cloneTree(false));
+            m_comboParamsp->add("combo_outputs__V");
+            m_comboDeclsp->add(
+                packedVar(fl, "combo_outputs__V", m_packedOutWidth, m_packedOutFourstate));
+            m_cComboParamsp->add(outp->dpiArgType(true, false));
+            if (m_dlComboArgsp) m_dlComboArgsp->add(outp->name());
+            if (m_hasClk) {
+                m_seqPortsp->add(outp->cloneTree(false));
+                m_seqParamsp->add("tmp_outputs__V");
+                m_seqDeclsp->add(
+                    packedVar(fl, "seq_outputs__V", m_packedOutWidth, m_packedOutFourstate));
+                m_tmpDeclsp->add(
+                    packedVar(fl, "tmp_outputs__V", m_packedOutWidth, m_packedOutFourstate));
+                m_nbAssignsp->add("seq_outputs__V <= tmp_outputs__V;\n");
+                m_cSeqParamsp->add(outp->dpiArgType(true, false));
+                if (m_dlSeqArgsp) m_dlSeqArgsp->add(outp->name());
+            }
+            VL_DO_DANGLING(outp->deleteTree(), outp);
+        }
+    }
+
+    static bool isPackable(const AstVar* varp) {
+        // Integral ports that can be assigned from a part-select of a packed vector
+        const AstNodeDType* dtypep = varp->dtypep()->skipRefp();
+        if (const AstNodeUOrStructDType* const sdtypep = VN_CAST(dtypep, NodeUOrStructDType)) {
+            return sdtypep->packed();
+        }
+        while (const AstPackArrayDType* const adtypep = VN_CAST(dtypep, PackArrayDType)) {
+            dtypep = adtypep->subDTypep()->skipRefp();
+        }
+        const AstBasicDType* const basicp = VN_CAST(dtypep, BasicDType);
+        return basicp && basicp->isIntegralOrPacked();
+    }
+
+    void scanPackedPorts(const AstNodeModule* modp) {
+        bool unpackedInput = false;
+        for (const AstNode* stmtp = modp->stmtsp(); stmtp; stmtp = stmtp->nextp()) {
+            const AstVar* const varp = VN_CAST(stmtp, Var);
+            if (!varp || !varp->isIO()) continue;
+            const bool fourstate = varp->dtypep()->skipRefp()->isFourstate();
+            if (varp->direction() == VDirection::INPUT) {
+                if (varp->isPrimaryClock()) continue;
+                if (!isPackable(varp)) {
+                    unpackedInput = true;
+                    continue;
+                }
+                m_packedInWidth = packedLsb(m_packedInWidth) + varp->width();
+                m_packedInFourstate |= fourstate;
+            } else if (varp->direction() == VDirection::OUTPUT && isPackable(varp)) {
+                m_packedOutWidth = packedLsb(m_packedOutWidth) + varp->width();
+                m_packedOutFourstate |= fourstate;
+            }
         }
+        m_comboSkip = m_packedInWidth && !unpackedInput;
     }
 
     static bool checkIfClockExists(const AstNodeModule* modp) {
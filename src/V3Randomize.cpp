@@ -40,9 +40,12 @@
 #include "V3FileLine.h"
 #include "V3Global.h"
 #include "V3MemberMap.h"
+#include "V3Stats.h"
 #include "V3UniqueNames.h"
 
+#include <iomanip>
 #include <queue>
+#include <sstream>
 #include <tuple>
 #include <utility>
 
@@ -1340,20 +1343,39 @@ class ConstraintExprVisitor final : public VNVisitor {
         VL_DO_DANGLING(nodep->unlinkFrBack()->deleteTree(), nodep);
     }
     void visit(AstConstraintExpr* nodep) override {
+        // Weights of a dist from V3Width are constants, not for the solver
+        AstDistItem* distItemsp = nullptr;
+        if (nodep->distItemsp()) distItemsp = nodep->distItemsp()->unlinkFrBackWithNext();
         iterateChildren(nodep);
         if (m_wantSingle) {
+            if (distItemsp) VL_DO_DANGLING(distItemsp->deleteTree(), distItemsp);
             nodep->replaceWith(nodep->exprp()->unlinkFrBack());
             VL_DO_DANGLING(nodep->deleteTree(), nodep);
             return;
         }
+        FileLine* const fl = nodep->fileline();
+        AstNodeModule* const genModp = VN_AS(m_genp->user2p(), NodeModule);
         // Only hard constraints are currently supported
-        AstCMethodHard* const callp = new AstCMethodHard{
-            nodep->fileline(),
-            new AstVarRef{nodep->fileline(), VN_AS(m_genp->user2p(), NodeModule), m_genp,
-                          VAccess::READWRITE},
-            VCMethod::RANDOMIZER_HARD, nodep->exprp()->unlinkFrBack()};
+        AstCMethodHard* const callp
+            = new AstCMethodHard{fl, new AstVarRef{fl, genModp, m_genp, VAccess::READWRITE},
+                                 VCMethod::RANDOMIZER_HARD, nodep->exprp()->unlinkFrBack()};
         callp->dtypeSetVoid();
-        nodep->replaceWith(callp->makeStmt());
+        AstNode* const stmtsp = callp->makeStmt();
+        // Then the weight of each dist item, so the solver can choose values by weight
+        for (AstDistItem* itemp = distItemsp; itemp; itemp = VN_AS(itemp->nextp(), DistItem)) {
+            AstInsideRange* const rangep = VN_AS(itemp->rangep(), InsideRange);
+            AstNodeExpr* const distArgsp = rangep->lhsp()->unlinkFrBack();
+            distArgsp->addNext(rangep->rhsp()->unlinkFrBack());
+            distArgsp->addNext(itemp->weightp()->unlinkFrBack());
+            distArgsp->addNext(new AstConst{fl, AstConst::BitTrue{}, itemp->isWhole()});
+            AstCMethodHard* const distCallp
+                = new AstCMethodHard{fl, new AstVarRef{fl, genModp, m_genp, VAccess::READWRITE},
+                                     VCMethod::RANDOMIZER_DIST, distArgsp};
+            distCallp->dtypeSetVoid();
+            stmtsp->addNext(distCallp->makeStmt());
+        }
+        if (distItemsp) VL_DO_DANGLING(distItemsp->deleteTree(), distItemsp);
+        nodep->replaceWith(stmtsp);
         VL_DO_DANGLING(nodep->deleteTree(), nodep);
     }
     void visit(AstCMethodHard* nodep) override {
@@ -1677,6 +1699,190 @@ public:
     }
 };
 
+//######################################################################
+// Values of a rand variable allowed by a constraint comparing it to constants
+
+class RandomizeDirectRanges final {
+public:
+    // TYPES
+    using Ranges = std::vector<std::pair<uint64_t, uint64_t>>;  // Sorted inclusive ranges
+
+private:
+    // STATE
+    const AstVar* m_varp = nullptr;  // Variable compared
+    uint64_t m_mask = 0;  // Mask of variable width
+    bool m_ok = true;  // Constraint is understood
+    Ranges m_ranges;  // Values allowed, as bit patterns of the variable
+
+    // METHODS
+    static Ranges normalize(Ranges ranges) {
+        std::sort(ranges.begin(), ranges.end());
+        Ranges result;
+        for (const auto& range : ranges) {
+            if (!result.empty() && range.first <= result.back().second + 1) {
+                result.back().second = std::max(result.back().second, range.second);
+            } else {
+                result.push_back(range);
+            }
+        }
+        return result;
+    }
+    static Ranges unite(Ranges a, const Ranges& b) {
+        a.insert(a.end(), b.begin(), b.end());
+        return normalize(a);
+    }
+    static Ranges complement(const Ranges& a, uint64_t mask) {
+        Ranges result;
+        uint64_t next = 0;
+        for (const auto& range : a) {
+            if (range.first > next) result.emplace_back(next, range.first - 1);
+            next = range.second + 1;
+        }
+        if (a.empty() || a.back().second < mask) result.emplace_back(next, mask);
+        return result;
+    }
+    // Variable reference an operand is, possibly extended
+    static const AstVarRef* varOperand(const AstNodeExpr* exprp, bool& signExtendr) {
+        if (const AstExtendS* const extendp = VN_CAST(exprp, ExtendS)) {
+            signExtendr = true;
+            exprp = extendp->lhsp();
+        } else if (const AstExtend* const extendp = VN_CAST(exprp, Extend)) {
+            exprp = extendp->lhsp();
+        }
+        return VN_CAST(exprp, VarRef);
+    }
+    Ranges fail() {
+        m_ok = false;
+        return {};
+    }
+    Ranges compareRanges(const AstNodeBiop* nodep) {
+        enum Op : uint8_t { LT, LTE, GT, GTE, EQ, NEQ };
+        Op op;
+        bool isSigned = false;
+        if (VN_IS(nodep, Eq) || VN_IS(nodep, EqWild)) {
+            op = EQ;
+        } else if (VN_IS(nodep, Neq)) {
+            op = NEQ;
+        } else if (VN_IS(nodep, Lt) || VN_IS(nodep, LtS)) {
+            op = LT;
+            isSigned = VN_IS(nodep, LtS);
+        } else if (VN_IS(nodep, Lte) || VN_IS(nodep, LteS)) {
+            op = LTE;
+            isSigned = VN_IS(nodep, LteS);
+        } else if (VN_IS(nodep, Gt) || VN_IS(nodep, GtS)) {
+            op = GT;
+            isSigned = VN_IS(nodep, GtS);
+        } else if (VN_IS(nodep, Gte) || VN_IS(nodep, GteS)) {
+            op = GTE;
+            isSigned = VN_IS(nodep, GteS);
+        } else {
+            return fail();
+        }
+        const AstNodeExpr* operandp = nodep->lhsp();
+        const AstConst* constp = VN_CAST(nodep->rhsp(), Const);
+        if (!constp) {
+            operandp = nodep->rhsp();
+            constp = VN_CAST(nodep->lhsp(), Const);
+            // Constant on the left, so compare the other way around
+            static const Op swapped[] = {GT, GTE, LT, LTE, EQ, NEQ};
+            op = swapped[op];
+        }
+        bool signExtend = false;
+        const AstVarRef* const refp = varOperand(operandp, signExtend);
+        if (!constp || constp->num().isFourState() || !refp) return fail();
+        // Small enough that all values compared fit in int64_t
+        const int width = refp->width();
+        const int cmpWidth = operandp->width();
+        if (refp->varp()->width() != width || cmpWidth > 32 || constp->width() > 32) {
+            return fail();
+        }
+        if (m_varp && m_varp != refp->varp()) return fail();
+        m_varp = refp->varp();
+        m_mask = VL_MASK_Q(width);
+        const uint64_t constValue = constp->toUQuad() & VL_MASK_Q(cmpWidth);
+        int64_t value = static_cast<int64_t>(constValue);
+        if (isSigned && ((constValue >> (cmpWidth - 1)) & 1)) value -= 1LL << cmpWidth;
+        // In each half of the variable's bit patterns the value compared is the
+        // pattern plus an offset, from sign extension or a signed comparison
+        const int64_t half = 1LL << (width - 1);
+        Ranges result;
+        for (const bool upper : {false, true}) {
+            const int64_t lo = upper ? half : 0;
+            const int64_t hi = upper ? 2 * half - 1 : half - 1;
+            int64_t offset = 0;
+            if (upper && signExtend) {
+                offset = isSigned ? -2 * half : (1LL << cmpWidth) - 2 * half;
+            } else if (upper && isSigned && cmpWidth == width) {
+                offset = -2 * half;
+            }
+            const auto addValues = [&](int64_t vlo, int64_t vhi) {
+                vlo = std::max(vlo - offset, lo);
+                vhi = std::min(vhi - offset, hi);
+                if (vlo <= vhi) result.emplace_back(vlo, vhi);
+            };
+            // Beyond any value compared
+            const int64_t vmin = -(1LL << 34);
+            const int64_t vmax = 1LL << 34;
+            switch (op) {
+            case LT: addValues(vmin, value - 1); break;
+            case LTE: addValues(vmin, value); break;
+            case GT: addValues(value + 1, vmax); break;
+            case GTE: addValues(value, vmax); break;
+            case EQ: addValues(value, value); break;
+            case NEQ:
+                addValues(vmin, value - 1);
+                addValues(value + 1, vmax);
+                break;
+            }
+        }
+        return normalize(result);
+    }
+    Ranges exprRanges(const AstNodeExpr* nodep) {
+        if (!m_ok || nodep->width() != 1) return fail();
+        if (VN_IS(nodep, LogAnd) || VN_IS(nodep, And)) {
+            const AstNodeBiop* const biopp = VN_AS(nodep, NodeBiop);
+            const Ranges lhs = exprRanges(biopp->lhsp());
+            return intersect(lhs, exprRanges(biopp->rhsp()));
+        } else if (VN_IS(nodep, LogOr) || VN_IS(nodep, Or)) {
+            const AstNodeBiop* const biopp = VN_AS(nodep, NodeBiop);
+            const Ranges lhs = exprRanges(biopp->lhsp());
+            return unite(lhs, exprRanges(biopp->rhsp()));
+        } else if (VN_IS(nodep, LogNot) || VN_IS(nodep, Not)) {
+            const Ranges lhs = exprRanges(VN_AS(nodep, NodeUniop)->lhsp());
+            return complement(lhs, m_mask);
+        } else if (const AstNodeBiop* const biopp = VN_CAST(nodep, NodeBiop)) {
+            return compareRanges(biopp);
+        }
+        return fail();
+    }
+
+public:
+    // CONSTRUCTORS
+    explicit RandomizeDirectRanges(const AstNodeExpr* exprp)
+        : m_ranges{exprRanges(exprp)} {}
+
+    // METHODS
+    bool ok() const { return m_ok && m_varp; }
+    const AstVar* varp() const { return m_varp; }
+    const Ranges& ranges() const { return m_ranges; }
+    static Ranges intersect(const Ranges& a, const Ranges& b) {
+        Ranges result;
+        auto ait = a.begin();
+        auto bit = b.begin();
+        while (ait != a.end() && bit != b.end()) {
+            const uint64_t lo = std::max(ait->first, bit->first);
+            const uint64_t hi = std::min(ait->second, bit->second);
+            if (lo <= hi) result.emplace_back(lo, hi);
+            if (ait->second < bit->second) {
+                ++ait;
+            } else {
+                ++bit;
+            }
+        }
+        return result;
+    }
+};
+
 //######################################################################
 // Visitor that defines a randomize method where needed
 
@@ -1716,6 +1922,10 @@ class RandomizeVisitor final : public VNVisitor {
     std::map<std::string, AstCDType*> m_randcDtypes;  // RandC data type deduplication
     AstConstraint* m_constraintp = nullptr;  // Current constraint
     std::set<std::string> m_writtenVars;  // Track write_var calls per class to avoid duplicates
+    std::unordered_set<const AstClass*> m_extendedClassps;  // Classes extended by another
+    std::unordered_set<const AstClass*> m_withClassps;  // Classes randomized with inline
+                                                        // constraints
+    VDouble0 m_statDirectSampled;  // Rand variables sampled without the solver
 
     // METHODS
     // Check if two nodes are semantically equivalent (not pointer equality):
@@ -2303,6 +2513,142 @@ class RandomizeVisitor final : public VNVisitor {
         return commonp;
     }
 
+    // Take out of the solver the constraints of each rand variable only compared to
+    // constants, returning statements sampling those variables directly instead
+    AstNode* newDirectSamples(AstClass* const nodep) {
+        // Classes whose constraints may change at runtime, or are used by another
+        // randomize(), keep the solver
+        if (nodep->user1() != IS_RANDOMIZED || nodep->extendsp()
+            || m_extendedClassps.count(nodep) || m_withClassps.count(nodep)
+            || getRandModeVar(nodep) || getConstraintModeVar(nodep)) {
+            return nullptr;
+        }
+        using Ranges = RandomizeDirectRanges::Ranges;
+        struct Candidate final {
+            std::vector<AstConstraintExpr*> itemps;  // Constraints on only this variable
+            Ranges domain;  // Values all those constraints allow
+            bool ok = true;  // No other constraint refers to this variable
+        };
+        std::vector<AstVar*> varps;  // Candidates in declaration order
+        std::unordered_map<const AstVar*, Candidate> candidates;
+        for (AstNode* stmtp = nodep->stmtsp(); stmtp; stmtp = stmtp->nextp()) {
+            AstVar* const varp = VN_CAST(stmtp, Var);
+            if (!varp || !varp->rand().isRand() || varp->isRandC()
+                || varp->lifetime().isStatic() || varp->globalConstrained()) {
+                continue;
+            }
+            const AstBasicDType* const dtypep = VN_CAST(varp->dtypep()->skipRefp(), BasicDType);
+            if (!dtypep || !dtypep->isIntegralOrPacked() || varp->width() > 32) continue;
+            varps.push_back(varp);
+            candidates[varp];
+        }
+        if (varps.empty()) return nullptr;
+        for (AstNode* stmtp = nodep->stmtsp(); stmtp; stmtp = stmtp->nextp()) {
+            const AstConstraint* const constrp = VN_CAST(stmtp, Constraint);
+            if (!constrp) continue;
+            for (AstNode* itemp = constrp->itemsp(); itemp; itemp = itemp->nextp()) {
+                std::set<Candidate*> refs;
+                bool viaMemberSel = false;
+                itemp->foreach([&](const AstNodeVarRef* refp) {
+                    const auto it = candidates.find(refp->varp());
+                    if (it != candidates.end()) refs.insert(&it->second);
+                });
+                itemp->foreach([&](const AstMemberSel* selp) {
+                    const auto it = candidates.find(selp->varp());
+                    if (it == candidates.end()) return;
+                    refs.insert(&it->second);
+                    viaMemberSel = true;
+                });
+                if (refs.empty()) continue;
+                AstConstraintExpr* const exprItemp = VN_CAST(itemp, ConstraintExpr);
+                if (exprItemp && !exprItemp->isSoft() && !exprItemp->isDisableSoft()
+                    && !viaMemberSel && refs.size() == 1) {
+                    const RandomizeDirectRanges ranges{exprItemp->exprp()};
+                    const auto it = candidates.find(ranges.varp());
+                    if (ranges.ok() && it != candidates.end()) {
+                        Candidate& candidate = it->second;
+                        candidate.domain
+                            = candidate.itemps.empty()
+                                  ? ranges.ranges()
+                                  : RandomizeDirectRanges::intersect(candidate.domain,
+                                                                     ranges.ranges());
+                        candidate.itemps.push_back(exprItemp);
+                        continue;
+                    }
+                }
+                for (Candidate* const candidatep : refs) candidatep->ok = false;
+            }
+        }
+
+        AstNode* stmtsp = nullptr;
+        for (AstVar* const varp : varps) {
+            const Candidate& candidate = candidates[varp];
+            // Unsatisfiable constraints are left for the solver to report
+            if (!candidate.ok || candidate.itemps.empty() || candidate.domain.empty()) continue;
+            // Weight each range as VlRandomFastSolver would
+            const auto rangeSize = [](const std::pair<uint64_t, uint64_t>& range) {
+                return static_cast<double>(range.second - range.first) + 1.0;
+            };
+            const uint64_t mask = VL_MASK_Q(varp->width());
+            Ranges ranges;
+            std::vector<double> weights;
+            double total = 0;
+            for (const AstConstraintExpr* const itemp : candidate.itemps) {
+                for (const AstDistItem* distp = itemp->distItemsp(); distp;
+                     distp = VN_AS(distp->nextp(), DistItem)) {
+                    const AstInsideRange* const rangep = VN_AS(distp->rangep(), InsideRange);
+                    const uint64_t lo = VN_AS(rangep->lhsp(), Const)->toUQuad() & mask;
+                    const uint64_t hi = VN_AS(rangep->rhsp(), Const)->toUQuad() & mask;
+                    const Ranges items = lo <= hi ? Ranges{{lo, hi}}  //
+                                                  : Ranges{{0, hi}, {lo, mask}};
+                    double size = 0;
+                    for (const auto& item : items) size += rangeSize(item);
+                    const double weight
+                        = static_cast<double>(VN_AS(distp->weightp(), Const)->toUQuad());
+                    const double valueWeight = distp->isWhole() ? weight / size : weight;
+                    for (const auto& range :
+                         RandomizeDirectRanges::intersect(candidate.domain, items)) {
+                        ranges.push_back(range);
+                        weights.push_back(valueWeight * rangeSize(range));
+                        total += weights.back();
+                    }
+                }
+            }
+            if (!(total > 0)) {
+                // No weights, so choose uniformly
+                ranges = candidate.domain;
+                weights.clear();
+                for (const auto& range : ranges) weights.push_back(rangeSize(range));
+            }
+            std::string rangesText;
+            std::ostringstream weightsText;
+            weightsText << std::scientific << std::setprecision(17);
+            for (size_t i = 0; i < ranges.size(); ++i) {
+                if (i) {
+                    rangesText += ", ";
+                    weightsText << ", ";
+                }
+                rangesText += "{" + cvtToStr(ranges[i].first) + "ULL, "
+                              + cvtToStr(ranges[i].second) + "ULL}";
+                weightsText << weights[i];
+            }
+            FileLine* const fl = varp->fileline();
+            AstCStmt* const samplep = new AstCStmt{fl};
+            samplep->add("{\nstatic const VlRandomTable __Vtable({" + rangesText + "}, {"
+                         + weightsText.str() + "});\n");
+            samplep->add(new AstVarRef{fl, nodep, varp, VAccess::WRITE});
+            samplep->add(" = __Vtable.sample(__Vm_rng);\n}\n");
+            stmtsp = AstNode::addNext(stmtsp, samplep);
+
+            for (AstConstraintExpr* itemp : candidate.itemps) {
+                VL_DO_DANGLING(pushDeletep(itemp->unlinkFrBack()), itemp);
+            }
+            varp->user3(true);  // Not randomized again by __Vbasic_randomize
+            ++m_statDirectSampled;
+        }
+        return stmtsp;
+    }
+
     void addBasicRandomizeBody(AstFunc* const basicRandomizep, AstClass* const nodep,
                                AstVar* randModeVarp) {
         UINFO(9, "addBasicRTB " << nodep);
@@ -2537,8 +2883,10 @@ class RandomizeVisitor final : public VNVisitor {
         // Both IS_RANDOMIZED and IS_RANDOMIZED_GLOBAL classes need full constraint support
         // IS_RANDOMIZED_GLOBAL classes can be randomized independently
         AstNodeExpr* beginValp = nullptr;
+        AstNode* directSamplesp = nullptr;
         AstVar* genp = getRandomGenerator(nodep);
         if (genp) {
+            directSamplesp = newDirectSamples(nodep);
             nodep->foreachMember([&](AstClass* const classp, AstConstraint* const constrp) {
                 AstTask* taskp = VN_AS(constrp->user2p(), Task);
                 if (!taskp) {
@@ -2619,6 +2967,14 @@ class RandomizeVisitor final : public VNVisitor {
 
         AstVarRef* const fvarRefp = new AstVarRef{fl, fvarp, VAccess::WRITE};
         randomizep->addStmtsp(new AstAssign{fl, fvarRefp, beginValp});
+        if (directSamplesp) {
+            // Only once the solver succeeded, as a failed randomize() keeps the values
+            randomizep->addStmtsp(new AstIf{
+                fl,
+                new AstNeq{fl, new AstVarRef{fl, fvarp, VAccess::READ},
+                           new AstConst{fl, AstConst::WidthedValue{}, 32, 0}},
+                directSamplesp});
+        }
 
         if (AstTask* const resizeAllTaskp
             = VN_AS(m_memberMap.findMember(nodep, "__Vresize_constrained_arrays"), Task)) {
@@ -3045,12 +3401,33 @@ public:
             });
         });
 
+        // Find classes whose constraints another randomize() also uses
+        nodep->foreach([&](AstClass* classp) {
+            if (classp->extendsp()) m_extendedClassps.insert(classp->extendsp()->classp());
+        });
+        nodep->foreach([&](AstNodeFTaskRef* refp) {
+            if (refp->name() != "randomize" || !VN_IS(refp->pinsp(), With)) return;
+            if (const AstMethodCall* const callp = VN_CAST(refp, MethodCall)) {
+                const AstNodeDType* const fromDTypep = callp->fromp()->dtypep();
+                const AstClassRefDType* const refDTypep
+                    = fromDTypep ? VN_CAST(fromDTypep->skipRefp(), ClassRefDType) : nullptr;
+                if (refDTypep) m_withClassps.insert(refDTypep->classp());
+                return;
+            }
+            // Called on this, from a method of the class
+            AstNode* upp = refp;
+            while (upp && !VN_IS(upp, Class)) upp = upp->backp();
+            if (upp) m_withClassps.insert(VN_AS(upp, Class));
+        });
+
         iterate(nodep);
         nodep->foreach([&](AstConstraint* constrp) {
             VL_DO_DANGLING(pushDeletep(constrp->unlinkFrBack()), constrp);
         });
     }
-    ~RandomizeVisitor() override = default;
+    ~RandomizeVisitor() override {
+        V3Stats::addStat("Randomize, directly sampled variables", m_statDirectSampled);
+    }
 };
 
 //######################################################################
@@ -195,6 +195,8 @@ class AwaitVisitor final : public VNVisitor {
     std::set<AstSenTree*> m_processDomains;  // Sentrees from the current process
     // Variables written by suspendable processes
     std::vector<AstVarScope*> m_writtenBySuspendable;
+    std::map<const AstVarScope*, AstSenTree*> m_resumeSenTrees;  // Scheduler -> resume() domain
+    std::vector<AstCMethodHard*> m_togglesp;  // Delay scheduler toggle() calls
 
     // METHODS
     // Add arguments to a resume() call based on arguments in the suspending call
@@ -233,11 +235,37 @@ class AwaitVisitor final : public VNVisitor {
             postp->method(VCMethod::SCHED_DO_POST_UPDATES);
             m_postUpdatesr = AstNode::addNext(m_postUpdatesr, postp->makeStmt());
         }
-        // Put it in an active
-        AstActive* const activep = new AstActive{flp, "_timing", sentreep};
+        addResumeActive(schedulerp, sentreep, resumep);
+    }
+    // Put a resume() call in an active
+    void addResumeActive(AstVarScope* schedulerp, AstSenTree* sentreep, AstCMethodHard* resumep) {
+        m_resumeSenTrees.emplace(schedulerp, sentreep);
+        AstActive* const activep = new AstActive{sentreep->fileline(), "_timing", sentreep};
         activep->addStmtsp(resumep->makeStmt());
         m_lbs.emplace_back(m_scopeTopp, activep);
     }
+    // Variables toggled by the delay scheduler change when it resumes, which needs a resume()
+    // call even if no process awaits a delay
+    void addToggle(AstCMethodHard* const methodp) {
+        AstVarScope* const schedulerp = VN_AS(methodp->fromp(), VarRef)->varScopep();
+        AstSenTree*& sentreep = m_resumeSenTrees[schedulerp];
+        if (!sentreep) {
+            FileLine* const flp = methodp->fileline();
+            AstCMethodHard* const awaitingp
+                = new AstCMethodHard{flp, new AstVarRef{flp, schedulerp, VAccess::READ},
+                                     VCMethod::SCHED_AWAITING_CURRENT_TIME};
+            awaitingp->dtypeSetBit();
+            sentreep = new AstSenTree{flp, new AstSenItem{flp, VEdgeType::ET_TRUE, awaitingp}};
+            v3Global.rootp()->topScopep()->addSenTreesp(sentreep);
+            AstCMethodHard* const resumep = new AstCMethodHard{
+                flp, new AstVarRef{flp, schedulerp, VAccess::READWRITE}, VCMethod::SCHED_RESUME};
+            resumep->dtypeSetVoid();
+            addResumeActive(schedulerp, sentreep, resumep);
+        }
+        AstVarScope* const vscp = VN_AS(methodp->pinsp(), VarRef)->varScopep();
+        m_externalDomains[vscp].insert(sentreep);
+        vscp->varp()->setWrittenBySuspendable();
+    }
 
     // VISITORS
     void visit(AstNodeProcedure* const nodep) override {
@@ -277,6 +305,10 @@ class AwaitVisitor final : public VNVisitor {
             m_writtenBySuspendable.push_back(nodep->varScopep());
         }
     }
+    void visit(AstCMethodHard* nodep) override {
+        if (nodep->method() == VCMethod::SCHED_TOGGLE) m_togglesp.push_back(nodep);
+        iterateChildren(nodep);
+    }
     void visit(AstExprStmt* nodep) override { iterateChildren(nodep); }
 
     //--------------------
@@ -291,6 +323,7 @@ public:
         , m_postUpdatesr{postUpdatesr}
         , m_externalDomains{externalDomains} {
         iterate(nodep);
+        for (AstCMethodHard* const methodp : m_togglesp) addToggle(methodp);
     }
     ~AwaitVisitor() override = default;
 };
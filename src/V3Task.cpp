@@ -241,6 +241,38 @@ private:
             }
         }
     }
+    static void checkDpiDeferred(AstNodeFTask* nodep) {
+        // Deferred calls complete after the caller continues, so can't pass anything back
+        string reason;
+        if (!nodep->dpiImport()) {
+            reason = "is not a DPI import";
+        } else if (nodep->dpiContext()) {
+            reason = "is a 'context' DPI import";
+        } else if (nodep->isFunction()) {
+            reason = "returns a value";
+        } else {
+            for (AstNode* stmtp = nodep->stmtsp(); stmtp; stmtp = stmtp->nextp()) {
+                const AstVar* const portp = VN_CAST(stmtp, Var);
+                if (!portp || !portp->isIO()) continue;
+                if (portp->isWritable()) {
+                    reason = "has output argument '" + portp->prettyName() + "'";
+                } else if (portp->isDpiOpenArray()) {
+                    reason = "has open array argument '" + portp->prettyName() + "'";
+                }
+                if (!reason.empty()) break;
+            }
+        }
+        if (!reason.empty()) {
+            nodep->v3error("dpi_deferred function " << nodep->prettyNameQ() << " " << reason
+                                                    << "\n"
+                                                    << nodep->warnMore()
+                                                    << "... Suggest remove dpi_deferred, only "
+                                                       "void imports with inputs are deferred");
+            nodep->dpiDeferred(false);
+            return;
+        }
+        v3Global.setHasDpiDeferred();
+    }
     void visit(AstNodeFTask* nodep) override {
         UINFO(9, "  TASK " << nodep);
         VL_RESTORER(m_curVxp);
@@ -248,6 +280,7 @@ private:
         if (nodep->dpiImport()) m_curVxp->noInline(true);
         if (nodep->classMethod()) m_curVxp->noInline(true);  // Until V3Task supports it
         if (nodep->recursive()) m_curVxp->noInline(true);
+        if (nodep->dpiDeferred()) checkDpiDeferred(nodep);
         if (nodep->isConstructor()) {
             m_curVxp->noInline(true);
             m_ctorp = nodep;
@@ -373,6 +406,41 @@ struct TaskDpiUtils final {
         const std::string& size = std::to_string(dtypep->width());
         return {"VL_SET_"s + sizeChar + "_" + vecType + "(" + size + ", ", true};
     }
+    // Returns true if a DPI import wrapper needs the symbol table for deferred calls, to
+    // queue a call, or to wait for queued calls running on the worker thread
+    static bool dpiDeferredSyms(const AstNodeFTask* nodep) {
+        if (!nodep->dpiImport() || !v3Global.hasDpiDeferred()) return false;
+        return nodep->dpiDeferred() || v3Global.opt.threads() > 1;
+    }
+    // Returns true if an unpacked array's internal storage has the same layout
+    // as its canonical DPI C array, so it may be passed by pointer without a copy
+    static bool dpiZeroCopy(const AstVar* varp) {
+        if (varp->isDpiOpenArray()) return false;
+        const AstUnpackArrayDType* const unpackp
+            = VN_CAST(varp->dtypep()->skipRefp(), UnpackArrayDType);
+        if (!unpackp) return false;
+        const AstNodeDType* elemp = unpackp->subDTypep()->skipRefp();
+        while (const AstUnpackArrayDType* const subp = VN_CAST(elemp, UnpackArrayDType)) {
+            elemp = subp->subDTypep()->skipRefp();
+        }
+        const AstBasicDType* const basicp = VN_CAST(elemp, BasicDType);
+        if (!basicp) return false;
+        // svBitVecVal words match IData and VlWide storage when no bits are
+        // unused, so the C code cannot set bits outside the variable's width
+        if (basicp->isDpiBitVec()) {
+            return basicp->width() == VL_EDATASIZE
+                   || (basicp->width() > VL_QUADSIZE && basicp->width() % VL_EDATASIZE == 0);
+        }
+        // C primitives match CData/SData/IData/QData/double storage
+        switch (basicp->keyword()) {
+        case VBasicDTypeKwd::BYTE:
+        case VBasicDTypeKwd::SHORTINT:
+        case VBasicDTypeKwd::INT:
+        case VBasicDTypeKwd::LONGINT:
+        case VBasicDTypeKwd::DOUBLE: return true;
+        default: return false;
+        }
+    }
 };
 
 //######################################################################
@@ -405,6 +473,7 @@ class TaskVisitor final : public VNVisitor {
     DpiCFuncs m_dpiNames;  // Map of all created DPI functions
     VDouble0 m_statInlines;  // Statistic tracking
     VDouble0 m_statHierDpisWithCosts;  // Statistic tracking
+    VDouble0 m_statDpiZeroCopy;  // Statistic tracking
 
     // METHODS
 
@@ -609,6 +678,47 @@ class TaskVisitor final : public VNVisitor {
         }
     }
 
+    void copyAliasedDpiInputs(const V3TaskConnects& tconnects, const string& namePrefix,
+                              AstNode* beginp) {
+        // Zero-copy DPI array inputs pass the caller's storage.  If another
+        // argument of the call refers to the same variable the C function would
+        // see it aliased, so pass a copy instead.
+        std::map<const AstVar*, int> argRefs;  // Number of arguments referring to each variable
+        for (const auto& itr : tconnects) {
+            if (!itr.second || !itr.second->exprp()) continue;
+            std::set<const AstVar*> vars;
+            itr.second->exprp()->foreach([&](const AstVarRef* varrefp) {  //
+                vars.insert(varrefp->varp());
+            });
+            for (const AstVar* const varp : vars) ++argRefs[varp];
+        }
+        for (const auto& itr : tconnects) {
+            AstVar* const portp = itr.first;
+            AstArg* const argp = itr.second;
+            if (!argp || !argp->exprp() || portp->isWritable() || portp->isRef()
+                || portp->isConstRef() || !TaskDpiUtils::dpiZeroCopy(portp)) {
+                continue;
+            }
+            AstNodeExpr* const pinp = argp->exprp();
+            if (!pinp->exists([&](const AstVarRef* varrefp) {  //
+                    return argRefs[varrefp->varp()] > 1;
+                })) {
+                continue;
+            }
+            AstVarScope* const newvscp
+                = createVarScope(portp, namePrefix + "__" + portp->shortName());
+            pinp->replaceWith(new AstVarRef{newvscp->fileline(), newvscp, VAccess::READ});
+            pushDeletep(pinp);  // Cloned by connectPortMakeInAssign
+            AstAssign* const preassp = connectPortMakeInAssign(pinp, newvscp, false);
+            // Put assignment in FRONT of all other statements
+            if (AstNode* const afterp = beginp->nextp()) {
+                afterp->unlinkFrBackWithNext();
+                AstNode::addNext<AstNode, AstNode>(preassp, afterp);
+            }
+            beginp->addNext(preassp);
+        }
+    }
+
     AstNode* createInlinedFTask(AstNodeFTaskRef* refp, const string& namePrefix,
                                 AstVarScope* outvscp) {
         // outvscp is the variable for functions only, if nullptr, it's a task
@@ -703,6 +813,7 @@ class TaskVisitor final : public VNVisitor {
         // Convert complicated outputs to temp signals
         {
             const V3TaskConnects tconnects = V3Task::taskConnects(refp, refp->taskp()->stmtsp());
+            if (refp->taskp()->dpiImport()) copyAliasedDpiInputs(tconnects, namePrefix, beginp);
             for (const auto& itr : tconnects) {
                 AstVar* const portp = itr.first;
                 AstArg* const argp = itr.second;
@@ -710,7 +821,8 @@ class TaskVisitor final : public VNVisitor {
             }
         }
         // First argument is symbol table, then output if a function
-        const bool needSyms = !refp->taskp()->dpiImport() || v3Global.opt.profExec();
+        const bool needSyms = !refp->taskp()->dpiImport() || v3Global.opt.profExec()
+                              || TaskDpiUtils::dpiDeferredSyms(refp->taskp());
         if (needSyms) ccallp->argTypes("vlSymsp");
 
         if (refp->taskp()->dpiContext()) {
@@ -860,26 +972,41 @@ class TaskVisitor final : public VNVisitor {
         return stmtsp;
     }
 
-    // Create dispatch wrapper
-    AstCFunc* makeDpiExportDispatcher(AstNodeFTask* const nodep, AstVar* const rtnvarp) {
+    // Create dispatch wrapper. A direct wrapper is instead passed the symbol table and
+    // the export implementation, and is called by V3EmitCSyms's --dpi-export-direct entry
+    // points for each scope, avoiding the scope lookup.
+    AstCFunc* makeDpiExportDispatcher(AstNodeFTask* const nodep, AstVar* const rtnvarp,
+                                      bool direct) {
         // Verilog name has __ conversion and other tricks, to match DPI C code, back that out
         FileLine* const flp = nodep->fileline();
         const std::string cname = AstNode::prettyName(nodep->cname());
-        checkLegalCIdentifier(nodep, cname);
-        const char* const tmpSuffixp = V3Task::dpiTemporaryVarSuffix();
+        if (!direct) checkLegalCIdentifier(nodep, cname);
         const std::string rtnType = rtnvarp ? rtnvarp->dpiArgType(true, true) : "";
         // The function we are building
-        AstCFunc* const funcp = new AstCFunc{flp, cname, m_scopep, rtnType};
-        funcp->dpiExportDispatcher(true);
+        AstCFunc* const funcp
+            = new AstCFunc{flp, direct ? cname + "__Vdirect" : cname, m_scopep, rtnType};
+        funcp->dpiExportDispatcher(!direct);
+        funcp->dpiExportDirect(direct);
         funcp->dpiContext(nodep->dpiContext());
         funcp->dontCombine(true);
         funcp->entryPoint(true);
         funcp->isStatic(true);
+        funcp->isLoose(direct);
         funcp->protect(false);
         funcp->cname(cname);
+        if (direct) funcp->argTypes(EmitCUtil::symClassVar() + ", void* __Vcbp");
         // Add DPI Export to top, since it's a global function
         m_topScopep->scopep()->addBlocksp(funcp);
 
+        const std::string cbtype
+            = VIdProtect::protect(v3Global.opt.prefix() + "__Vcb_" + nodep->cname() + "_t");
+        AstCStmt* const prep = new AstCStmt{flp};
+        funcp->addStmtsp(prep);
+        if (direct) {
+            prep->add(cbtype + " __Vcb = reinterpret_cast<" + cbtype + ">(__Vcbp);");
+            return makeDpiExportCall(nodep, rtnvarp, funcp, "vlSymsp");
+        }
+
         // Note this function may dispatch on a different class.
         // Thus we need to be careful not to assume a particular function layout.
         //
@@ -891,8 +1018,6 @@ class TaskVisitor final : public VNVisitor {
         // it's not worth optimizing.
 
         // Peramble - fetch the exproted function from the scope table
-        AstCStmt* const prep = new AstCStmt{flp};
-        funcp->addStmtsp(prep);
         // Static doesn't need save-restore as if below will re-fill proper value
         prep->add("static int __Vfuncnum = -1;\n");
         // First time init (faster than what the compiler does if we did a singleton
@@ -903,10 +1028,17 @@ class TaskVisitor final : public VNVisitor {
         prep->add("const VerilatedScope* const __Vscopep = Verilated::dpiScope();\n");
         // If 'dpiScope()' fails and '__Vscopep' is null; the exportFind function throws an error
         // If __Vcb is null the exportFind function throws and error
-        const std::string cbtype
-            = VIdProtect::protect(v3Global.opt.prefix() + "__Vcb_" + nodep->cname() + "_t");
         prep->add(cbtype + " __Vcb = reinterpret_cast<" + cbtype
                   + ">(VerilatedScope::exportFind(__Vscopep, __Vfuncnum));");
+        return makeDpiExportCall(nodep, rtnvarp, funcp,
+                                 "(" + EmitCUtil::symClassName() + "*)(__Vscopep->symsp())");
+    }
+
+    // Add the export dispatcher's call of '__Vcb' with the given symbol table
+    AstCFunc* makeDpiExportCall(AstNodeFTask* const nodep, AstVar* const rtnvarp,
+                                AstCFunc* const funcp, const std::string& symsp) {
+        FileLine* const flp = nodep->fileline();
+        const char* const tmpSuffixp = V3Task::dpiTemporaryVarSuffix();
 
         // Convert input/inout DPI arguments to Internal types, and construct the call
         AstCStmt* const callp = new AstCStmt{flp};
@@ -925,7 +1057,7 @@ class TaskVisitor final : public VNVisitor {
         // Call callback
         callp->add("(*__Vcb)(");
         // First argument is the Syms
-        callp->add("(" + EmitCUtil::symClassName() + "*)(__Vscopep->symsp())");
+        callp->add(symsp);
         // Add function arguments
         for (AstNode* stmtp = nodep->stmtsp(); stmtp; stmtp = stmtp->nextp()) {
             AstVar* const portp = VN_CAST(stmtp, Var);
@@ -1009,8 +1141,12 @@ class TaskVisitor final : public VNVisitor {
                                              std::forward_as_tuple(nodep, signature, nullptr));
         if (pair.second) {
             // First time encountering this cname. Create Import prototype / Export entry point
-            AstCFunc* const funcp = nodep->dpiExport() ? makeDpiExportDispatcher(nodep, rtnvarp)
-                                                       : makeDpiImportPrototype(nodep, rtnvarp);
+            AstCFunc* const funcp = nodep->dpiExport()
+                                        ? makeDpiExportDispatcher(nodep, rtnvarp, false)
+                                        : makeDpiImportPrototype(nodep, rtnvarp);
+            if (funcp && nodep->dpiExport() && v3Global.opt.dpiExportDirect()) {
+                makeDpiExportDispatcher(nodep, rtnvarp, true);
+            }
             std::get<2>(pair.first->second) = funcp;
             return funcp;
         } else {
@@ -1072,6 +1208,26 @@ class TaskVisitor final : public VNVisitor {
             cfuncp->addStmtsp(AstCStmt::profExecSectionPush(nodep->fileline(), "dpiimports"));
         }
 
+        // A deferred call copies its inputs into a queued closure, which converts them and
+        // makes the call when the queue is dispatched.  If the queue runs on a worker thread,
+        // other imports must first wait for any queued calls still running, so imported
+        // code is never called concurrently.
+        AstCStmt* deferp = nullptr;
+        if (nodep->dpiDeferred()) {
+            deferp = new AstCStmt{nodep->fileline(),
+                                  "vlSymsp->__Vm_dpiDeferred.push([=]() mutable {\n"};
+        } else if (TaskDpiUtils::dpiDeferredSyms(nodep)) {
+            const string stmt = "vlSymsp->__Vm_dpiDeferred.wait();";
+            cfuncp->addStmtsp(new AstCStmt{nodep->fileline(), stmt});
+        }
+        const auto addStmtp = [&](AstNode* stmtp) {
+            if (deferp) {
+                deferp->add(stmtp);
+            } else {
+                cfuncp->addStmtsp(stmtp);
+            }
+        };
+
         // Convert input/inout arguments to DPI types
         string args;
         for (AstNode* stmtp = cfuncp->argsp(); stmtp; stmtp = stmtp->nextp()) {
@@ -1107,6 +1263,15 @@ class TaskVisitor final : public VNVisitor {
                                + name + " (&" + propName + ", &" + portp->name() + ");\n");
                         cfuncp->addStmtsp(new AstCStmt{portp->fileline(), varCode});
                         args += "&" + name;
+                    } else if (TaskDpiUtils::dpiZeroCopy(portp)) {
+                        // Pass the internal storage directly, it matches the DPI layout
+                        const int unpackDim
+                            = portp->dtypep()->skipRefp()->dimensions(false).second;
+                        args += "reinterpret_cast<" + portp->dpiArgType(false, false) + ">(&"
+                                + portp->name();
+                        for (int i = 0; i < unpackDim; ++i) args += "[0]";
+                        args += ")";
+                        ++m_statDpiZeroCopy;
                     } else {
                         if (portp->isWritable() && portp->basicp()->isDpiPrimitive()) {
                             if (!VN_IS(portp->dtypep()->skipRefp(), UnpackArrayDType)) args += "&";
@@ -1114,10 +1279,9 @@ class TaskVisitor final : public VNVisitor {
 
                         args += portp->name() + tmpSuffixp;
 
-                        cfuncp->addStmtsp(createDpiTemp(portp, tmpSuffixp));
+                        addStmtp(createDpiTemp(portp, tmpSuffixp));
                         if (portp->isNonOutput()) {
-                            cfuncp->addStmtsp(
-                                createAssignInternalToDpi(portp, false, "", tmpSuffixp));
+                            addStmtp(createAssignInternalToDpi(portp, false, "", tmpSuffixp));
                         }
                     }
                 }
@@ -1146,16 +1310,20 @@ class TaskVisitor final : public VNVisitor {
                 cfuncp->addStmtsp(cstmtp);
             } else {
                 // Othervise just call it
-                cfuncp->addStmtsp(callp->makeStmt());
+                addStmtp(callp->makeStmt());
             }
         }
+        if (deferp) {
+            deferp->add("});");
+            cfuncp->addStmtsp(deferp);
+        }
 
         // Convert output/inout arguments back to internal type
         for (AstNode* stmtp = cfuncp->argsp(); stmtp; stmtp = stmtp->nextp()) {
             if (AstVar* const portp = VN_CAST(stmtp, Var)) {
                 portp->protect(false);  // No additional exposure - already part of shown proto
                 if (portp->isIO() && (portp->isWritable() || portp->isFuncReturn())
-                    && !portp->isDpiOpenArray()) {
+                    && !portp->isDpiOpenArray() && !TaskDpiUtils::dpiZeroCopy(portp)) {
                     AstVarScope* const portvscp = VN_AS(
                         portp->user2p(), VarScope);  // Remembered when we created it earlier
                     cfuncp->addStmtsp(
@@ -1274,6 +1442,7 @@ class TaskVisitor final : public VNVisitor {
         cfuncp->entryPoint(!nodep->dpiImport());
         cfuncp->funcPublic(nodep->taskPublic());
         cfuncp->dpiContext(nodep->dpiContext());
+        cfuncp->dpiDeferred(nodep->dpiDeferred());
         cfuncp->dpiExportImpl(nodep->dpiExport());
         cfuncp->dpiImportWrapper(nodep->dpiImport());
         cfuncp->recursive(nodep->recursive());
@@ -1290,8 +1459,9 @@ class TaskVisitor final : public VNVisitor {
 
         if (cfuncp->dpiImportWrapper()) cfuncp->cname(nodep->cname());
 
-        const bool needSyms
-            = (!nodep->dpiImport() && !nodep->taskPublic()) || v3Global.opt.profExec();
+        const bool needSyms = (!nodep->dpiImport() && !nodep->taskPublic())
+                              || v3Global.opt.profExec()
+                              || TaskDpiUtils::dpiDeferredSyms(nodep);
         if (needSyms) cfuncp->argTypes(EmitCUtil::symClassVar());
 
         if (!nodep->dpiImport() && !nodep->taskPublic()) {
@@ -1679,6 +1849,7 @@ public:
         V3Stats::addStat("Optimizations, Functions inlined", m_statInlines);
         V3Stats::addStat("Optimizations, Hierarchical DPI wrappers with costs",
                          m_statHierDpisWithCosts);
+        V3Stats::addStat("Optimizations, DPI arrays passed without copy", m_statDpiZeroCopy);
     }
 };
 
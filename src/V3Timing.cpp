@@ -34,6 +34,11 @@
 //   type T_NEEDS_PROC. Using only nodes type T_NEEDS_PROC assures the flags are only propagated
 //   through paths leading to nodes that actually use VlProcess.
 //
+// TimingParallelVisitor, with --timing-parallel, finds processes that only suspend on delays,
+// and that do not write variables read or written by another such process. The delays of
+// these processes use delayParallel(), so the delay scheduler may resume them concurrently.
+// Side effects such as I/O are treated as writing one shared resource.
+//
 // TimingControlVisitor is the one that actually performs transformations:
 // - for each intra-assignment timing control:
 //     - if it's a continuous assignment, transform it into an always
@@ -70,6 +75,7 @@
 #include "V3MemberMap.h"
 #include "V3SenExprBuilder.h"
 #include "V3SenTree.h"
+#include "V3Stats.h"
 #include "V3UniqueNames.h"
 
 #include <queue>
@@ -440,6 +446,164 @@ public:
     ~TimingSuspendableVisitor() override = default;
 };
 
+// ######################################################################
+//  Find processes that can be resumed in parallel
+
+class TimingParallelVisitor final : public VNVisitorConst {
+    // NODE STATE
+    //  Ast{NodeProcedure,CFunc}::user2()  -> uint8_t. Timing flags, see TimingSuspendableVisitor
+    // const VNUser2InUse m_user2InUse;      (Allocated for use in SuspendableVisitor)
+
+    // STATE
+    std::unordered_set<const AstNode*>& m_parallelps;  // Output processes
+    AstActive* m_activep = nullptr;  // Current active
+    bool m_eligible = false;  // Current process may be resumed in parallel
+    bool m_impure = false;  // Under a node with side effects
+    std::set<const void*> m_reads;  // Variables (or resources) read by current process
+    std::set<const void*> m_writes;  // Variables (or resources) written by current process
+    std::set<const AstCFunc*> m_funcps;  // Functions visited for current process
+    std::set<const void*> m_claimedReads;  // Read by processes already made parallel
+    std::set<const void*> m_claimedWrites;  // Written by processes already made parallel
+    VDouble0 m_statParallel;  // Statistic tracking
+    VDouble0 m_statSerial;  // Statistic tracking
+
+    // Stands for side effects ordered with respect to each other, e.g. output
+    static const void* sideEffects() {
+        static const int s_resource = 0;
+        return &s_resource;
+    }
+
+    // METHODS
+    static bool intersects(const std::set<const void*>& a, const std::set<const void*>& b) {
+        for (const void* const keyp : a) {
+            if (b.count(keyp)) return true;
+        }
+        return false;
+    }
+    void visitProcess(AstNodeProcedure* nodep) {
+        // Must suspend, and only through delays of its own
+        if (!hasFlags(nodep, T_SUSPENDEE) || hasFlags(nodep, T_HAS_PROC)) return;
+        if (m_activep->sentreep()->hasClocked()) return;  // Resumed by a trigger scheduler
+        m_eligible = true;
+        m_reads.clear();
+        m_writes.clear();
+        m_funcps.clear();
+        iterateChildrenConst(nodep);
+        if (!m_eligible) return;
+        // Independent of all processes made parallel so far; later ones check against this
+        if (intersects(m_writes, m_claimedReads) || intersects(m_writes, m_claimedWrites)
+            || intersects(m_reads, m_claimedWrites)) {
+            ++m_statSerial;
+            return;
+        }
+        m_claimedReads.insert(m_reads.begin(), m_reads.end());
+        m_claimedWrites.insert(m_writes.begin(), m_writes.end());
+        m_parallelps.insert(nodep);
+        ++m_statParallel;
+    }
+    void notEligible() { m_eligible = false; }
+
+    // VISITORS
+    void visit(AstNodeModule* nodep) override {
+        if (VN_IS(nodep, Class)) return;  // Class processes are not at module scope
+        iterateChildrenConst(nodep);
+    }
+    void visit(AstActive* nodep) override {
+        VL_RESTORER(m_activep);
+        m_activep = nodep;
+        iterateChildrenConst(nodep);
+    }
+    void visit(AstNodeProcedure* nodep) override {
+        if (VN_IS(nodep, Always) || VN_IS(nodep, Initial)) visitProcess(nodep);
+    }
+    void visit(AstNodeVarRef* nodep) override {
+        if (!m_eligible) return;
+        const AstVar* const varp = nodep->varp();
+        const AstNodeDType* const dtypep = varp->dtypep()->skipRefp();
+        if (VN_IS(dtypep, ClassRefDType) || (dtypep->basicp() && dtypep->basicp()->isEvent())) {
+            notEligible();
+            return;
+        }
+        if (varp->isFuncLocal()) return;  // Storage of this call
+        const AstVarScope* const vscp = nodep->varScopep();
+        if (m_impure || nodep->access().isWriteOrRW()) m_writes.insert(vscp);
+        if (m_impure || nodep->access().isReadOrRW()) m_reads.insert(vscp);
+    }
+    void visit(AstNodeCCall* nodep) override {
+        if (!m_eligible) return;
+        AstCFunc* const funcp = nodep->funcp();
+        // A called coroutine may be shared by processes, and V3Trace (which runs later) sets
+        // the coroutine's single trace activity flag after each of its awaits, so parallel
+        // resumption would race on it. Calls to other functions get per-call-site flags.
+        if (hasFlags(funcp, T_SUSPENDEE)) {
+            notEligible();
+            return;
+        }
+        if (VN_IS(nodep, CMethodCall) || VN_IS(nodep, CNew) || funcp->dpiImportWrapper()
+            || !funcp->scopep() || VN_IS(funcp->scopep()->modp(), Class)) {
+            notEligible();
+            return;
+        }
+        iterateChildrenConst(nodep);
+        if (m_funcps.insert(funcp).second) iterateChildrenConst(funcp);
+    }
+    void visit(AstNodeAssign* nodep) override {
+        if (nodep->timingControlp()) notEligible();
+        iterateChildrenConst(nodep);
+    }
+    void visit(AstAssignDly* nodep) override { notEligible(); }
+    void visit(AstCAwait* nodep) override { notEligible(); }
+    void visit(AstCExpr* nodep) override { notEligible(); }
+    void visit(AstCExprUser* nodep) override { notEligible(); }
+    void visit(AstCStmt* nodep) override { notEligible(); }
+    void visit(AstCStmtUser* nodep) override { notEligible(); }
+    void visit(AstDisableFork* nodep) override { notEligible(); }
+    void visit(AstEventControl* nodep) override { notEligible(); }
+    void visit(AstFinish* nodep) override { notEligible(); }
+    void visit(AstFinishFork* nodep) override { notEligible(); }
+    void visit(AstFireEvent* nodep) override { notEligible(); }
+    void visit(AstFork* nodep) override { notEligible(); }
+    void visit(AstNew* nodep) override { notEligible(); }
+    void visit(AstNewCopy* nodep) override { notEligible(); }
+    void visit(AstRand* nodep) override {
+        if (!nodep->seedp()) notEligible();  // Thread's random state
+        visit(static_cast<AstNode*>(nodep));
+    }
+    void visit(AstRandRNG* nodep) override { notEligible(); }
+    void visit(AstURandomRange* nodep) override { notEligible(); }
+    void visit(AstStop* nodep) override { notEligible(); }
+    void visit(AstWait* nodep) override { notEligible(); }
+    void visit(AstWaitFork* nodep) override { notEligible(); }
+    void visit(AstJumpBlock* nodep) override { iterateChildrenConst(nodep); }
+    void visit(AstNode* nodep) override {
+        if (!m_eligible) return;
+        if (!nodep->isPure() && (VN_IS(nodep, NodeExpr) || VN_IS(nodep, NodeStmt))) {
+            // Assume all operands are written. Other than container methods, e.g. $display,
+            // these are also ordered with respect to other side effects.
+            VL_RESTORER(m_impure);
+            m_impure = true;
+            if (!VN_IS(nodep, CMethodHard) && !VN_IS(nodep, AssocSel)
+                && !VN_IS(nodep, WildcardSel)) {
+                m_writes.insert(sideEffects());
+            }
+            iterateChildrenConst(nodep);
+            return;
+        }
+        iterateChildrenConst(nodep);
+    }
+
+public:
+    // CONSTRUCTORS
+    TimingParallelVisitor(AstNetlist* nodep, std::unordered_set<const AstNode*>& parallelps)
+        : m_parallelps{parallelps} {
+        iterateConst(nodep);
+    }
+    ~TimingParallelVisitor() override {
+        V3Stats::addStat("Timing, parallel processes", m_statParallel);
+        V3Stats::addStat("Timing, parallel processes made serial", m_statSerial);
+    }
+};
+
 // ######################################################################
 //  Transform nodes affected by timing
 
@@ -465,6 +629,7 @@ class TimingControlVisitor final : public VNVisitor {
     // Current context
     AstNetlist* const m_netlistp;  // Root node
     AstScope* const m_scopeTopp = m_netlistp->topScopep()->scopep();  // Scope at the top
+    const std::unordered_set<const AstNode*>& m_parallelps;  // Processes resumed in parallel
     AstClass* m_classp = nullptr;  // Current class
     AstScope* m_scopep = nullptr;  // Current scope
     AstActive* m_activep = nullptr;  // Current active
@@ -498,8 +663,23 @@ class TimingControlVisitor final : public VNVisitor {
     // Other
     SenTreeFinder m_finder{m_netlistp};  // Sentree finder and uniquifier
     SenExprBuilder* m_senExprBuilderp = nullptr;  // Sens expression builder for current m_scope
+    VDouble0 m_statClockToggles;  // Statistic tracking
+    VDouble0 m_statCoroutines;  // Statistic tracking
+    VDouble0 m_statFrameHintBytes;  // Statistic tracking
 
     // METHODS
+    // Estimate bytes of a variable's storage in a coroutine frame
+    static uint64_t frameHintBytes(const AstNodeDType* dtypep) {
+        dtypep = dtypep->skipRefp();
+        if (const AstUnpackArrayDType* const adtypep = VN_CAST(dtypep, UnpackArrayDType)) {
+            return adtypep->elementsConst() * frameHintBytes(adtypep->subDTypep());
+        }
+        if (const AstBasicDType* const bdtypep = VN_CAST(dtypep, BasicDType)) {
+            if (bdtypep->isString()) return sizeof(std::string);
+        }
+        if (dtypep->isIntegralOrPacked()) return dtypep->widthTotalBytes();
+        return 16;  // Containers, class references, etc.; roughly a handle
+    }
     // Transform an assignment with an intra timing control into a timing control with the
     // assignment under it
     AstNode* factorOutTimingControl(AstNodeAssign* nodep) const {
@@ -542,6 +722,64 @@ class TimingControlVisitor final : public VNVisitor {
         m_netlistp->delaySchedulerp(m_delaySchedp->varp());
         return m_delaySchedp;
     }
+    // If the process is a free-running clock generator 'always #<const> clk = ~clk', replace
+    // it with a toggle() registered with the delay scheduler at time 0, so no coroutine is
+    // resumed on each edge. Returns true if replaced.
+    bool convertClockToggle(AstAlways* nodep) {
+        if (!v3Global.opt.fClockToggle()) return false;
+        if (m_classp || m_activep->sentreep()->hasClocked()) return false;
+        AstDelay* const delayp = VN_CAST(nodep->stmtsp(), Delay);
+        if (!delayp || delayp->nextp() || delayp->isCycleDelay()) return false;
+        const AstAssign* const assignp = VN_CAST(delayp->stmtsp(), Assign);
+        if (!assignp || assignp->nextp() || assignp->timingControlp()) return false;
+        const AstVarRef* const lhsp = VN_CAST(assignp->lhsp(), VarRef);
+        if (!lhsp) return false;
+        AstVarScope* const vscp = lhsp->varScopep();
+        AstVar* const varp = vscp->varp();
+        // The scheduler writes the variable directly, which would bypass a force
+        if (varp->width() != 1 || !varp->dtypep()->skipRefp()->isIntegralOrPacked()
+            || varp->isSc() || varp->isForced()) {
+            return false;
+        }
+        // Must assign the inverse of itself
+        const AstNodeExpr* invertedp = nullptr;
+        if (const AstNot* const notp = VN_CAST(assignp->rhsp(), Not)) {
+            invertedp = notp->lhsp();
+        } else if (const AstLogNot* const notp = VN_CAST(assignp->rhsp(), LogNot)) {
+            invertedp = notp->lhsp();
+        }
+        const AstVarRef* const refp = VN_CAST(invertedp, VarRef);
+        if (!refp || refp->varScopep() != vscp) return false;
+        // Must have a constant, non-zero period, scaled as in visit(AstDelay)
+        const AstConst* const constp = VN_CAST(V3Const::constifyEdit(delayp->lhsp()), Const);
+        if (!constp || constp->num().isFourState() || constp->num().is1Step()) return false;
+        const double timescaleFactor = calculateTimescaleFactor(delayp, delayp->timeunit());
+        uint64_t period;
+        if (constp->num().isDouble()) {
+            const double value = std::round(constp->num().toDouble() * timescaleFactor);
+            if (!(value >= 1.0 && value < 9.0e18)) return false;
+            period = static_cast<uint64_t>(value);
+        } else {
+            if (constp->num().width() > 64 || constp->isZero()) return false;
+            period = constp->num().toUQuad() * static_cast<uint64_t>(timescaleFactor);
+        }
+
+        FileLine* const flp = nodep->fileline();
+        AstConst* const periodp = new AstConst{flp, AstConst::Unsized64{}, period};
+        periodp->dtypeSetBitSized(64, VSigning::UNSIGNED);
+        AstCMethodHard* const togglep = new AstCMethodHard{
+            flp, new AstVarRef{flp, getCreateDelayScheduler(), VAccess::WRITE},
+            VCMethod::SCHED_TOGGLE, new AstVarRef{flp, vscp, VAccess::WRITE}};
+        togglep->addPinsp(periodp);
+        togglep->dtypeSetVoid();
+        // Written by the delay scheduler, outside of any function
+        varp->setWrittenByToggle();
+        UINFO(4, "Clock toggle of " << varp->prettyNameQ() << " every " << period);
+        nodep->replaceWith(new AstInitial{flp, togglep->makeStmt()});
+        VL_DO_DANGLING(nodep->deleteTree(), nodep);
+        ++m_statClockToggles;
+        return true;
+    }
     // Creates the delay sentree
     AstSenTree* getCreateDelaySenTree() {
         if (m_delaySensesp) return m_delaySensesp;
@@ -811,6 +1049,7 @@ class TimingControlVisitor final : public VNVisitor {
     }
     void visit(AstAlways* nodep) override {
         if (nodep->user1SetOnce()) return;
+        if (convertClockToggle(nodep)) return;
         VL_RESTORER(m_procp);
         VL_RESTORER(m_hasProcess);
         m_procp = nodep;
@@ -850,6 +1089,22 @@ class TimingControlVisitor final : public VNVisitor {
         if (!(hasFlags(nodep, T_SUSPENDEE))) return;
 
         nodep->rtnType("VlCoroutine");
+        // Note the expected frame size, as frames are allocated from VlCoroutineFramePool
+        // size classes; the C++ compiler determines the actual size
+        uint64_t hintBytes = 0;
+        nodep->foreach([&](const AstVar* varp) { hintBytes += frameHintBytes(varp->dtypep()); });
+        ++m_statCoroutines;
+        m_statFrameHintBytes += hintBytes;
+        {
+            AstComment* const commentp = new AstComment{
+                nodep->fileline(),
+                "Coroutine frame hint: " + cvtToStr(hintBytes) + " bytes of arguments and locals"};
+            if (AstNode* const stmtsp = nodep->stmtsp()) {
+                stmtsp->addHereThisAsNext(commentp);
+            } else {
+                nodep->addStmtsp(commentp);
+            }
+        }
         // If in a class, create a shared pointer to 'this'
         if (m_classp) {
             AstCStmt* const cstmtp = new AstCStmt{nodep->fileline(), "VL_KEEP_THIS;"};
@@ -908,7 +1163,8 @@ class TimingControlVisitor final : public VNVisitor {
         // Replace self with a 'co_await dlySched.delay(<valuep>)'
         AstCMethodHard* const delayMethodp = new AstCMethodHard{
             flp, new AstVarRef{flp, getCreateDelayScheduler(), VAccess::WRITE},
-            VCMethod::SCHED_DELAY, valuep};
+            m_parallelps.count(m_procp) ? VCMethod::SCHED_DELAY_PARALLEL : VCMethod::SCHED_DELAY,
+            valuep};
         delayMethodp->dtypeSetVoid();
         addProcessInfo(delayMethodp);
         addDebugInfo(delayMethodp);
@@ -1278,11 +1534,16 @@ class TimingControlVisitor final : public VNVisitor {
 
 public:
     // CONSTRUCTORS
-    explicit TimingControlVisitor(AstNetlist* nodep)
-        : m_netlistp{nodep} {
+    TimingControlVisitor(AstNetlist* nodep, const std::unordered_set<const AstNode*>& parallelps)
+        : m_netlistp{nodep}
+        , m_parallelps{parallelps} {
         iterate(nodep);
     }
-    ~TimingControlVisitor() override = default;
+    ~TimingControlVisitor() override {
+        V3Stats::addStat("Timing, clock toggles", m_statClockToggles);
+        V3Stats::addStat("Timing, coroutine functions", m_statCoroutines);
+        V3Stats::addStat("Timing, coroutine frame hint bytes", m_statFrameHintBytes);
+    }
 };
 
 //######################################################################
@@ -1294,7 +1555,12 @@ void V3Timing::timingAll(AstNetlist* nodep) {
         const VNUser1InUse m_user1InUse;
         const VNUser2InUse m_user2InUse;
         TimingSuspendableVisitor{nodep};
-        if (v3Global.usesTiming()) TimingControlVisitor{nodep};
+        std::unordered_set<const AstNode*> parallelps;
+        if (v3Global.usesTiming() && v3Global.opt.timingParallel()
+            && v3Global.opt.threads() > 1) {
+            TimingParallelVisitor{nodep, parallelps};
+        }
+        if (v3Global.usesTiming()) TimingControlVisitor{nodep, parallelps};
     }
     V3Global::dumpCheckGlobalTree("timing", 0, dumpTreeEitherLevel() >= 3);
 }
@@ -921,7 +921,8 @@ class TraceVisitor final : public VNVisitor {
             V3GraphVertex* const traceVtxp = m_tracep->user1u().toGraphVertex();
             new V3GraphEdge{&m_graph, varVtxp, traceVtxp, 1};
             if (nodep->varp()->isPrimaryInish()  // Always need to trace primary inputs
-                || nodep->varp()->isSigPublic()) {  // Or ones user can change
+                || nodep->varp()->isSigPublic()  // Or ones user can change
+                || nodep->varp()->isWrittenByToggle()) {  // Or ones the scheduler inverts
                 new V3GraphEdge{&m_graph, m_alwaysVtxp, traceVtxp, 1};
             }
         } else if (m_cfuncp && m_finding && nodep->access().isWriteOrRW()) {
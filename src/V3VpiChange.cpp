@@ -0,0 +1,167 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Value change hooks for VPI callbacks
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// Copyright 2003-2026 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+// V3VpiChange's Transformations:
+//
+// For each public variable, create a dirty flag variable in the same module.
+// Before each statement that writes the public variable, set its dirty
+// flag.  The flag is set before rather than after, so it is set even if
+// the statement then leaves the block, e.g. with a return.  The VPI runtime
+// then only compares the values of variables with cbValueChange callbacks
+// that have their dirty flag set.
+//
+// Top level IO, variables written other than from a function in a module
+// scope, and variables referenced by $c code, get no flag, so the runtime
+// will always compare them.
+//
+//*************************************************************************
+
+#include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
+
+#include "V3VpiChange.h"
+
+#include "V3Stats.h"
+
+#include <set>
+
+VL_DEFINE_DEBUG_FUNCTIONS;
+
+//######################################################################
+
+class VpiChangeVisitor final : public VNVisitor {
+    // NODE STATE
+    //  AstVar::user1()       -> bool. Written where a dirty flag can't be set
+    //  AstVar::user2p()      -> AstVar*. The dirty flag of this variable
+    //  AstVarScope::user2p() -> AstVarScope*. The dirty flag of this variable
+    const VNUser1InUse m_user1InUse;
+    const VNUser2InUse m_user2InUse;
+
+    // STATE
+    AstScope* m_scopep = nullptr;  // Current scope
+    AstCFunc* m_cfuncp = nullptr;  // Current function
+    AstNodeStmt* m_stmtp = nullptr;  // Current statement
+    bool m_inUserC = false;  // Under $c, which may write any referenced variable
+    std::vector<AstVarScope*> m_vscps;  // Each public variable
+    std::vector<std::pair<AstNodeStmt*, AstVarScope*>> m_writes;  // Each {statement, var} write
+    VDouble0 m_statHooks;  // Statistic tracking
+    VDouble0 m_statVars;  // Statistic tracking
+
+    // METHODS
+    static bool isWatchable(const AstVar* varp) {
+        return (varp->isSigUserRdPublic() || varp->isSigUserRWPublic()) && !varp->isParam()
+               && !varp->isPrimaryIO();
+    }
+    AstVarScope* dirtyVscp(AstVarScope* vscp) {
+        if (vscp->user2p()) return VN_AS(vscp->user2p(), VarScope);
+        AstVar* const varp = vscp->varp();
+        AstScope* const scopep = vscp->scopep();
+        FileLine* const flp = varp->fileline();
+        if (!varp->user2p()) {
+            AstVar* const newvarp = new AstVar{flp, VVarType::MODULETEMP,
+                                               V3VpiChange::DIRTY_PREFIX + varp->name(),
+                                               VFlagBitPacked{}, 1};
+            newvarp->sigPublic(true);  // Read by the runtime, so keep it
+            scopep->modp()->addStmtsp(newvarp);
+            varp->user2p(newvarp);
+            ++m_statVars;
+        }
+        AstVarScope* const newvscp = new AstVarScope{flp, scopep, VN_AS(varp->user2p(), Var)};
+        scopep->addVarsp(newvscp);
+        vscp->user2p(newvscp);
+        return newvscp;
+    }
+
+    // VISITORS
+    void visit(AstScope* nodep) override {
+        VL_RESTORER(m_scopep);
+        m_scopep = nodep;
+        iterateChildren(nodep);
+    }
+    void visit(AstVarScope* nodep) override {
+        if (isWatchable(nodep->varp())) m_vscps.push_back(nodep);
+    }
+    void visit(AstCFunc* nodep) override {
+        VL_RESTORER(m_cfuncp);
+        m_cfuncp = nodep;
+        iterateChildren(nodep);
+    }
+    void visit(AstNodeStmt* nodep) override {
+        VL_RESTORER(m_stmtp);
+        m_stmtp = nodep;
+        iterateChildren(nodep);
+    }
+    void visit(AstCExprUser* nodep) override {
+        VL_RESTORER(m_inUserC);
+        m_inUserC = true;
+        iterateChildren(nodep);
+    }
+    void visit(AstCStmtUser* nodep) override {
+        VL_RESTORER(m_stmtp);
+        VL_RESTORER(m_inUserC);
+        m_stmtp = nodep;
+        m_inUserC = true;
+        iterateChildren(nodep);
+    }
+    void visit(AstVarRef* nodep) override {
+        if (!nodep->access().isWriteOrRW() && !m_inUserC) return;
+        AstVarScope* const vscp = nodep->varScopep();
+        if (!isWatchable(vscp->varp())) return;
+        if (m_inUserC || !m_stmtp || !m_cfuncp || !m_scopep || VN_IS(m_scopep->modp(), Class)) {
+            // Can't tell when written, so the runtime must always compare
+            vscp->varp()->user1(true);
+            return;
+        }
+        m_writes.emplace_back(m_stmtp, vscp);
+    }
+    //--------------------
+    void visit(AstNode* nodep) override { iterateChildren(nodep); }
+
+public:
+    // CONSTRUCTORS
+    explicit VpiChangeVisitor(AstNetlist* netlistp) {
+        iterate(netlistp);
+        // Flag even variables the model never writes, as vpi_put_value may
+        for (AstVarScope* const vscp : m_vscps) {
+            if (!vscp->varp()->user1()) dirtyVscp(vscp);
+        }
+        // Set the dirty flag before each writing statement, once per variable
+        std::set<std::pair<AstNodeStmt*, AstVarScope*>> done;
+        for (const auto& pair : m_writes) {
+            AstNodeStmt* const stmtp = pair.first;
+            AstVarScope* const vscp = pair.second;
+            if (vscp->varp()->user1()) continue;
+            if (!done.emplace(pair).second) continue;
+            FileLine* const flp = stmtp->fileline();
+            AstVarScope* const dirtyp = dirtyVscp(vscp);
+            stmtp->addHereThisAsNext(
+                new AstAssign{flp, new AstVarRef{flp, dirtyp, VAccess::WRITE},
+                              new AstConst{flp, AstConst::BitTrue{}}});
+            ++m_statHooks;
+        }
+    }
+    ~VpiChangeVisitor() override {
+        V3Stats::addStat("VPI, Value change hooks", m_statHooks);
+        V3Stats::addStat("VPI, Value change hooked variables", m_statVars);
+    }
+};
+
+//######################################################################
+// VpiChange class functions
+
+void V3VpiChange::vpiChangeAll(AstNetlist* nodep) {
+    UINFO(2, __FUNCTION__ << ":");
+    { VpiChangeVisitor{nodep}; }  // Destruct before checking
+    V3Global::dumpCheckGlobalTree("vpichange", 0, dumpTreeEitherLevel() >= 3);
+}
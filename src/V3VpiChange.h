@@ -0,0 +1,34 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Value change hooks for VPI callbacks
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// Copyright 2003-2026 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#ifndef VERILATOR_V3VPICHANGE_H_
+#define VERILATOR_V3VPICHANGE_H_
+
+#include "config_build.h"
+#include "verilatedos.h"
+
+class AstNetlist;
+
+//============================================================================
+
+class V3VpiChange final {
+public:
+    // Prefix of the flag variable made for each public variable
+    static constexpr const char* const DIRTY_PREFIX = "__Vvpidirty__";
+    static void vpiChangeAll(AstNetlist* nodep) VL_MT_DISABLED;
+};
+
+#endif  // Guard
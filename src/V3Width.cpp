@@ -3081,6 +3081,9 @@ class WidthVisitor final : public VNVisitor {
             if (!VN_IS(itemp, InsideRange))
                 iterateCheck(nodep, "Dist Item", itemp, CONTEXT_DET, FINAL, subDTypep, EXTEND_EXP);
         }
+        if (AstConstraintExpr* const constrExprp = VN_CAST(nodep->backp(), ConstraintExpr)) {
+            distWeights(nodep, constrExprp);
+        }
         AstNodeExpr* newp = nullptr;
         for (AstDistItem* itemp = nodep->itemsp(); itemp;
              itemp = VN_AS(itemp->nextp(), DistItem)) {
@@ -3102,6 +3105,77 @@ class WidthVisitor final : public VNVisitor {
         VL_DO_DANGLING(pushDeletep(nodep), nodep);
     }
 
+    static const AstConst* distConst(const AstNode* nodep) {
+        if (const AstEnumItemRef* const refp = VN_CAST(nodep, EnumItemRef)) {
+            nodep = refp->itemp()->valuep();
+        }
+        const AstConst* const constp = VN_CAST(nodep, Const);
+        return constp && constp->width() <= VL_QUADSIZE && !constp->num().isFourState()
+                   ? constp
+                   : nullptr;
+    }
+    void distWeights(AstDist* nodep, AstConstraintExpr* constrExprp) {
+        // Keep constant weights of a hard dist on a single variable directly in a
+        // constraint, for V3Randomize to have the solver choose values by weight
+        if (!m_constraintp || constrExprp->isSoft()) return;
+        const AstNode* headp = constrExprp;
+        while (headp->backp() && headp->backp()->nextp() == headp) headp = headp->backp();
+        if (!VN_IS(headp->backp(), Constraint)) return;
+        const AstNodeExpr* exprp = nodep->exprp();
+        while (VN_IS(exprp, Extend) || VN_IS(exprp, ExtendS)) {
+            exprp = VN_AS(exprp, NodeUniop)->lhsp();
+        }
+        const AstVarRef* const refp = VN_CAST(exprp, VarRef);
+        if (!refp || !refp->varp()->rand().isRand() || refp->varp()->isRandC()) return;
+        if (nodep->exprp()->width() > VL_QUADSIZE || nodep->exprp()->isDouble()
+            || nodep->exprp()->isString())
+            return;
+        // Values the variable can compare equal to, as in insideItem()
+        const int width = refp->width();
+        const bool isSigned = nodep->exprp()->isSigned();
+        const uint64_t mask = VL_MASK_Q(width);
+        const int64_t smax = static_cast<int64_t>(mask >> 1);
+        const int64_t smin = -smax - 1;
+        AstDistItem* keptp = nullptr;
+        for (AstDistItem* itemp = nodep->itemsp(); itemp;
+             itemp = VN_AS(itemp->nextp(), DistItem)) {
+            const AstInsideRange* const irangep = VN_CAST(itemp->rangep(), InsideRange);
+            const AstConst* const lop = distConst(irangep ? irangep->lhsp() : itemp->rangep());
+            const AstConst* const hip = distConst(irangep ? irangep->rhsp() : itemp->rangep());
+            const AstConst* const weightp = distConst(itemp->weightp());
+            if (!lop || !hip || !weightp || weightp->num().isNegative()
+                || (isSigned && (!lop->isSigned() || !hip->isSigned()))) {
+                if (keptp) VL_DO_DANGLING(keptp->deleteTree(), keptp);
+                return;
+            }
+            if (weightp->num().isEqZero()) continue;
+            uint64_t lo;
+            uint64_t hi;
+            if (isSigned) {
+                const int64_t slo = std::max(lop->num().toSQuad(), smin);
+                const int64_t shi = std::min(hip->num().toSQuad(), smax);
+                if (slo > shi) continue;
+                lo = static_cast<uint64_t>(slo) & mask;
+                hi = static_cast<uint64_t>(shi) & mask;
+            } else {
+                lo = lop->toUQuad();
+                hi = std::min(hip->toUQuad(), mask);
+                if (lo > hi) continue;
+            }
+            FileLine* const flp = itemp->fileline();
+            AstConst* const keptLop = new AstConst{flp, AstConst::Unsized64{}, lo};
+            AstInsideRange* const keptRangep
+                = new AstInsideRange{flp, keptLop, new AstConst{flp, AstConst::Unsized64{}, hi}};
+            keptRangep->dtypeFrom(keptLop);
+            AstDistItem* const keptItemp = new AstDistItem{
+                flp, keptRangep, new AstConst{flp, AstConst::Unsized64{}, weightp->toUQuad()}};
+            keptItemp->isWhole(itemp->isWhole());
+            keptItemp->dtypeFrom(keptLop);
+            keptp = AstNode::addNext(keptp, keptItemp);
+        }
+        if (keptp) constrExprp->addDistItemsp(keptp);
+    }
+
     void visit(AstInside* nodep) override {
         userIterateAndNext(nodep->exprp(), WidthVP{CONTEXT_DET, PRELIM}.p());
         for (AstNode *nextip, *itemp = nodep->itemsp(); itemp; itemp = nextip) {
@@ -110,6 +110,7 @@
 #include "V3Unknown.h"
 #include "V3Unroll.h"
 #include "V3VariableOrder.h"
+#include "V3VpiChange.h"
 #include "V3Waiver.h"
 #include "V3Width.h"
 #include "V3WidthCommit.h"
@@ -480,6 +481,11 @@ static void process() {
             V3Const::constifyAll(v3Global.rootp());
             V3Dead::deadifyAllScoped(v3Global.rootp());
 
+            // Mark writes of public variables for VPI value change callbacks
+            if (v3Global.opt.vpi() && v3Global.opt.vpiChangeHooks()) {
+                V3VpiChange::vpiChangeAll(v3Global.rootp());
+            }
+
             // Create tracing logic, since we ripped out some signals the user might want to trace
             // Note past this point, we presume traced variables won't move between CFuncs
             // (It's OK if untraced temporaries move around, or vars
@@ -25,41 +25,52 @@
 #endif
 #include "V3Error.h"
 
+#include <algorithm>
+#include <vector>
+
 //********************************************************************
 // VlcBuckets - Container of all coverage point hits for a given test
 // This is a bitmap array - we store a single bit to indicate a test
 // has hit that point with sufficient coverage.
+// Once a test is fully read, compress() converts the bitmap to a sparse
+// list of the non-zero 64-bit words, which is much smaller for the
+// typical test that only covers a fraction of the design.
 
 class VlcBuckets final {
     // MEMBERS
-    uint64_t* m_datap = nullptr;  ///< Pointer to first bucket (dynamically allocated)
-    uint64_t m_dataSize = 0;  ///< Current entries in m_datap
+    std::vector<uint64_t> m_words;  ///< Dense bitmap, one bit per point
+    std::vector<uint64_t> m_sparseIdx;  ///< When compressed, index of each non-zero word
+    std::vector<uint64_t> m_sparseWords;  ///< When compressed, non-zero word values
     uint64_t m_bucketsCovered = 0;  ///< Num buckets with sufficient coverage
+    bool m_compressed = false;  ///< Data is in m_sparse*, not m_words
 
     static uint64_t covBit(uint64_t point) { return 1ULL << (point & 63); }
-    uint64_t allocSize() const { return sizeof(uint64_t) * m_dataSize / 64; }
+    static uint64_t popCount64(uint64_t word) {
+#if defined(__GNUC__) && !defined(VL_NO_BUILTINS)
+        return __builtin_popcountll(word);
+#else
+        uint64_t pop = 0;
+        for (; word; word &= word - 1) ++pop;
+        return pop;
+#endif
+    }
+    uint64_t word(uint64_t index) const {
+        if (!m_compressed) return index < m_words.size() ? m_words[index] : 0;
+        const auto it = std::lower_bound(m_sparseIdx.begin(), m_sparseIdx.end(), index);
+        if (it == m_sparseIdx.end() || *it != index) return 0;
+        return m_sparseWords[it - m_sparseIdx.begin()];
+    }
     void allocate(uint64_t point) {
-        const uint64_t oldsize = m_dataSize;
-        if (m_dataSize < point) m_dataSize = (point + 64) & ~63ULL;  // Keep power of two
-        m_dataSize *= 2;
-        // UINFO(9, "Realloc " << allocSize() << " for " << point << "  " << cvtToHex(m_datap));
-        uint64_t* const newp = static_cast<uint64_t*>(std::realloc(m_datap, allocSize()));
-        if (VL_UNCOVERABLE(!newp)) {
-            // cppcheck-suppress doubleFree  // cppcheck 1.90 bug - realloc doesn't free on fail
-            free(m_datap);  // LCOV_EXCL_LINE
-            v3fatal("Out of memory increasing buckets");  // LCOV_EXCL_LINE
-        }
-        m_datap = newp;
-        for (uint64_t i = oldsize; i < m_dataSize; i += 64) m_datap[i / 64] = 0;
+        UASSERT(!m_compressed, "Adding data to compressed buckets");
+        uint64_t size = m_words.size() ? m_words.size() : 16;
+        while (size <= point / 64) size *= 2;  // Keep power of two
+        m_words.resize(size, 0);
     }
 
 public:
     // CONSTRUCTORS
-    VlcBuckets() { allocate(1024); }
-    ~VlcBuckets() {
-        m_dataSize = 0;
-        VL_DO_CLEAR(free(m_datap), m_datap = nullptr);
-    }
+    VlcBuckets() = default;
+    ~VlcBuckets() = default;
 
     // ACCESSORS
     static uint64_t sufficient() { return 1; }
@@ -68,57 +79,73 @@ public:
     // METHODS
     void addData(uint64_t point, uint64_t hits) {
         if (hits >= sufficient()) {
-            // UINFO(9, "     addData " << point << " " << hits << " size=" << m_dataSize);
-            if (point >= m_dataSize) allocate(point);
-            m_datap[point / 64] |= covBit(point);
+            // UINFO(9, "     addData " << point << " " << hits << " size=" << m_words.size());
+            if (point / 64 >= m_words.size()) allocate(point);
+            m_words[point / 64] |= covBit(point);
             m_bucketsCovered++;
         }
     }
-    void clearHits(uint64_t point) const {
-        if (point >= m_dataSize) {
-            return;
-        } else {
-            m_datap[point / 64] &= ~covBit(point);
-        }
-    }
-    bool exists(uint64_t point) const {
-        if (point >= m_dataSize) {
-            return false;
-        } else {
-            return (m_datap[point / 64] & covBit(point)) ? 1 : 0;
-        }
-    }
-    uint64_t hits(uint64_t point) const {
-        if (point >= m_dataSize) {
-            return 0;
-        } else {
-            return (m_datap[point / 64] & covBit(point)) ? 1 : 0;
+    void compress() {
+        if (m_compressed) return;
+        for (uint64_t i = 0; i < m_words.size(); ++i) {
+            if (m_words[i]) {
+                m_sparseIdx.push_back(i);
+                m_sparseWords.push_back(m_words[i]);
+            }
         }
+        m_sparseIdx.shrink_to_fit();
+        m_sparseWords.shrink_to_fit();
+        std::vector<uint64_t>{}.swap(m_words);
+        m_compressed = true;
     }
+    bool exists(uint64_t point) const { return (word(point / 64) & covBit(point)) ? 1 : 0; }
+    uint64_t hits(uint64_t point) const { return (word(point / 64) & covBit(point)) ? 1 : 0; }
     uint64_t popCount() const {
         uint64_t pop = 0;
-        for (uint64_t i = 0; i < m_dataSize; ++i) {
-            if (hits(i)) ++pop;
-        }
+        for (const uint64_t w : m_compressed ? m_sparseWords : m_words) pop += popCount64(w);
         return pop;
     }
-    uint64_t dataPopCount(const VlcBuckets& remaining) {
+    // Number of points in this that are also in (uncompressed) remaining
+    uint64_t dataPopCount(const VlcBuckets& remaining) const {
+        UASSERT(!remaining.m_compressed, "dataPopCount against compressed buckets");
+        const std::vector<uint64_t>& other = remaining.m_words;
         uint64_t pop = 0;
-        for (uint64_t i = 0; i < m_dataSize; ++i) {
-            if (hits(i) && remaining.hits(i)) ++pop;
+        if (m_compressed) {
+            for (uint64_t i = 0; i < m_sparseIdx.size(); ++i) {
+                const uint64_t index = m_sparseIdx[i];
+                if (index >= other.size()) break;
+                pop += popCount64(m_sparseWords[i] & other[index]);
+            }
+        } else {
+            const uint64_t size = std::min(m_words.size(), other.size());
+            for (uint64_t i = 0; i < size; ++i) pop += popCount64(m_words[i] & other[i]);
         }
         return pop;
     }
+    // Remove from this (uncompressed) all points that are in ordata
     void orData(const VlcBuckets& ordata) {
-        for (uint64_t i = 0; i < m_dataSize; ++i) {
-            if (hits(i) && ordata.hits(i)) clearHits(i);
+        UASSERT(!m_compressed, "orData into compressed buckets");
+        if (ordata.m_compressed) {
+            for (uint64_t i = 0; i < ordata.m_sparseIdx.size(); ++i) {
+                const uint64_t index = ordata.m_sparseIdx[i];
+                if (index >= m_words.size()) break;
+                m_words[index] &= ~ordata.m_sparseWords[i];
+            }
+        } else {
+            const uint64_t size = std::min(m_words.size(), ordata.m_words.size());
+            for (uint64_t i = 0; i < size; ++i) m_words[i] &= ~ordata.m_words[i];
         }
     }
 
     void dump() const {
         std::cout << "#     ";
-        for (uint64_t i = 0; i < m_dataSize; ++i) {
-            if (hits(i)) std::cout << "," << i;
+        const uint64_t nwords = m_compressed ? m_sparseIdx.size() : m_words.size();
+        for (uint64_t i = 0; i < nwords; ++i) {
+            const uint64_t index = m_compressed ? m_sparseIdx[i] : i;
+            const uint64_t w = m_compressed ? m_sparseWords[i] : m_words[i];
+            for (uint64_t bit = 0; bit < 64; ++bit) {
+                if (w & (1ULL << bit)) std::cout << "," << (index * 64 + bit);
+            }
         }
         std::cout << "\n";
     }
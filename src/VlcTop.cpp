@@ -25,7 +25,9 @@
 
 #include <algorithm>
 #include <fstream>
+#include <queue>
 #include <string>
+#include <thread>
 #include <vector>
 
 //######################################################################
@@ -65,6 +67,7 @@ void VlcTop::readCoverage(const string& filename, bool nonfatal) {
             }
         }
     }
+    testp->buckets().compress();
 }
 
 void VlcTop::writeCoverage(const string& filename) {
@@ -175,33 +178,56 @@ void VlcTop::rank() {
         if (pointp->testsCovering()) remaining.addData(pointp->pointNum(), 1);
     }
 
-    // Additional Greedy algorithm
-    // O(n^2) Ouch.  Probably the thing to do is randomize the order of data
-    // then hierarchically solve a small subset of tests, and take resulting
-    // solution and move up to larger subset of tests.  (Aka quick sort.)
-    while (true) {
+    // Initial gain of every test; independent, so computed in parallel
+    std::vector<uint64_t> gains(bytime.size());
+    {
+        const size_t nthreads = std::max<size_t>(
+            1, std::min<size_t>(std::thread::hardware_concurrency(), bytime.size() / 64));
+        const auto calc = [&](size_t begin, size_t step) {
+            for (size_t i = begin; i < bytime.size(); i += step) {
+                gains[i] = bytime[i]->buckets().dataPopCount(remaining);
+            }
+        };
+        std::vector<std::thread> threads;
+        for (size_t t = 1; t < nthreads; ++t) threads.emplace_back(calc, t, nthreads);
+        calc(0, nthreads);
+        for (std::thread& thread : threads) thread.join();
+    }
+
+    // Lazy greedy set cover.  The points a test adds can only shrink as
+    // other tests are selected, so a stale gain is an upper bound and only
+    // the tests reaching the top of the queue need recomputing.  Ties pick
+    // the earliest test in bytime order, same as a full greedy scan.
+    struct Entry final {
+        uint64_t m_gain;  // Points added, as of iteration m_iter
+        uint64_t m_iter;  // Iteration when m_gain was computed
+        size_t m_index;  // Index in bytime
+        bool operator<(const Entry& rhs) const {
+            if (m_gain != rhs.m_gain) return m_gain < rhs.m_gain;
+            return m_index > rhs.m_index;
+        }
+    };
+    std::priority_queue<Entry> queue;
+    for (size_t i = 0; i < bytime.size(); ++i) {
+        if (gains[i]) queue.push(Entry{gains[i], nextrank, i});
+    }
+    while (!queue.empty()) {
         if (debug() >= 9) {
             UINFO_PREFIX("Left on iter" << nextrank << ": ");  // LCOV_EXCL_LINE
             remaining.dump();  // LCOV_EXCL_LINE
         }
-        VlcTest* bestTestp = nullptr;
-        uint64_t bestRemain = 0;
-        for (const auto& testp : bytime) {
-            if (!testp->rank()) {
-                uint64_t remain = testp->buckets().dataPopCount(remaining);
-                if (remain > bestRemain) {
-                    bestTestp = testp;
-                    bestRemain = remain;
-                }
-            }
-        }
-        if (VlcTest* const testp = bestTestp) {
-            testp->rank(nextrank++);
-            testp->rankPoints(bestRemain);
-            remaining.orData(bestTestp->buckets());
-        } else {
-            break;  // No test covering more stuff found
+        Entry top = queue.top();
+        queue.pop();
+        if (top.m_iter != nextrank) {  // Stale, recompute and requeue
+            top.m_gain = bytime[top.m_index]->buckets().dataPopCount(remaining);
+            top.m_iter = nextrank;
+            if (top.m_gain) queue.push(top);
+            continue;
         }
+        VlcTest* const testp = bytime[top.m_index];
+        testp->rank(nextrank++);
+        testp->rankPoints(top.m_gain);
+        remaining.orData(testp->buckets());
     }
 }
 
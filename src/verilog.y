@@ -244,6 +244,7 @@ BISONPRE_VERSION(3.7,%define api.header.include {"V3ParseBison.h"})
 %token<fl>              yVLT_COVERAGE_BLOCK_OFF     "coverage_block_off"
 %token<fl>              yVLT_COVERAGE_OFF           "coverage_off"
 %token<fl>              yVLT_COVERAGE_ON            "coverage_on"
+%token<fl>              yVLT_DPI_DEFERRED           "dpi_deferred"
 %token<fl>              yVLT_FORCEABLE              "forceable"
 %token<fl>              yVLT_FULL_CASE              "full_case"
 %token<fl>              yVLT_HIER_BLOCK             "hier_block"
@@ -8101,6 +8102,8 @@ vltItem:
                         { V3Control::addCoverageBlockOff(*$2, $4->toUInt()); }
         |       yVLT_COVERAGE_BLOCK_OFF vltDModule vltDBlock
                         { V3Control::addCoverageBlockOff(*$2, *$3); }
+        |       yVLT_DPI_DEFERRED vltDModuleE vltDFTaskE
+                        { V3Control::addDpiDeferred($<fl>1, *$2, *$3); }
         |       yVLT_FULL_CASE vltDFile
                         { V3Control::addCaseFull(*$2, 0); }
         |       yVLT_FULL_CASE vltDFile yVLT_D_LINES yaINTNUM
@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2026 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+test.top_filename = "t/t_cover_line.v"
+
+test.compile(verilator_flags2=['--cc --coverage --coverage-hit-only +define+ATTRIBUTE'],
+             threads=2)
+
+test.execute()
+
+# Points are hit-or-not, never counted, also when set from multiple threads
+test.file_grep(test.obj_dir + "/coverage.dat", r"^C '.*' 1$")
+test.file_grep(test.obj_dir + "/coverage.dat", r"^C '.*' 0$")
+test.file_grep_not(test.obj_dir + "/coverage.dat", r"^C '.*' ([2-9]|[1-9][0-9]+)$")
+
+test.passes()
@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2026 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+test.top_filename = "t/t_cover_toggle.v"
+
+test.compile(verilator_flags2=['--cc --coverage-toggle --coverage-hit-only'])
+
+test.execute()
+
+# Toggle points are hit-or-not, never counted
+test.file_grep(test.obj_dir + "/coverage.dat", r"^C '.*v_toggle.*' 1$")
+test.file_grep(test.obj_dir + "/coverage.dat", r"^C '.*v_toggle.*' 0$")
+test.file_grep_not(test.obj_dir + "/coverage.dat", r"^C '.*' ([2-9]|[1-9][0-9]+)$")
+
+test.passes()
@@ -0,0 +1,113 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// Copyright 2026 by Wilson Snyder. This program is free software; you can
+// redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include "verilated_cov.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+#include VM_PREFIX_INCLUDE
+
+//======================================================================
+
+int errors = 0;
+
+struct SampleState final {
+    std::vector<uint64_t> prev;  // Snapshot at start of window
+    std::vector<uint64_t> snap;  // Snapshot at end of window
+    std::vector<uint64_t> deltas;  // Counts gained in window
+    std::vector<uint64_t> totals;  // Sum of all deltas
+    std::vector<size_t> newHits;  // Points first hit in each window
+    std::vector<uint64_t> samples;  // Sample number of each callback
+};
+
+static void sampleCb(VerilatedCovContext* covp, uint64_t sample, void* userp) {
+    SampleState* const statep = static_cast<SampleState*>(userp);
+    statep->samples.push_back(sample);
+    statep->newHits.push_back(covp->snapshotDelta(statep->prev, statep->snap, statep->deltas));
+    statep->totals.resize(statep->deltas.size());
+    for (size_t i = 0; i < statep->deltas.size(); ++i) statep->totals[i] += statep->deltas[i];
+    statep->prev.swap(statep->snap);
+}
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get()}};
+    VerilatedCovContext* const covp = contextp->coveragep();
+
+    // Empty prev, so the first window counts everything from the start
+    SampleState state;
+    covp->sampleCb(10, sampleCb, &state);
+
+    topp->clk = 0;
+    topp->eval();
+    for (int cyc = 0; cyc < 50; ++cyc) {
+        topp->clk = 1;
+        topp->eval();
+        topp->clk = 0;
+        topp->eval();
+        covp->sampleTick();
+    }
+
+    TEST_CHECK_EQ(state.samples.size(), 5U);
+    TEST_CHECK_EQ(state.samples[4], 50U);
+    TEST_CHECK_NE(state.newHits[0], 0U);  // Includes cyc == 5
+    TEST_CHECK_EQ(state.newHits[1], 0U);
+    TEST_CHECK_NE(state.newHits[2], 0U);  // Includes cyc == 25
+    TEST_CHECK_EQ(state.newHits[3], 0U);
+    TEST_CHECK_EQ(state.newHits[4], 0U);
+
+    // Deltas over all windows sum to the last counts
+    std::vector<uint64_t> last;
+    covp->snapshot(last);
+    TEST_CHECK_EQ(last.size(), covp->points());
+    TEST_CHECK_EQ(state.totals.size(), last.size());
+    for (size_t i = 0; i < last.size(); ++i) {
+        TEST_CHECK_EQ(state.totals[i], last[i]);
+        TEST_CHECK_NE(covp->pointName(i), "");
+    }
+
+    // A counter that wraps gives its count since wrapping, not an underflow
+    static uint32_t wrapCount;
+    VL_COVER_INSERT(covp, "top.t", &wrapCount, "comment", "wrap_point");
+    wrapCount = 0xfffffff0U;  // After insert, which zeros it
+    const size_t wrapIndex = covp->points() - 1;
+    TEST_CHECK_NE(covp->pointName(wrapIndex).find("wrap_point"), std::string::npos);
+    covp->snapshot(state.prev);
+    wrapCount += 0x20;
+    covp->snapshotDelta(state.prev, state.snap, state.deltas);
+    TEST_CHECK_EQ(state.deltas[wrapIndex], 0x10U);
+
+    // After zero(), deltas are the counts since zeroing
+    covp->snapshot(state.prev);
+    covp->zero();
+    for (int cyc = 0; cyc < 5; ++cyc) {
+        topp->clk = 1;
+        topp->eval();
+        topp->clk = 0;
+        topp->eval();
+    }
+    covp->snapshotDelta(state.prev, state.snap, state.deltas);
+    TEST_CHECK_EQ(state.deltas[wrapIndex], 0U);
+    for (size_t i = 0; i < state.snap.size(); ++i) {
+        if (state.prev[i] > state.snap[i]) TEST_CHECK_EQ(state.deltas[i], state.snap[i]);
+    }
+
+    topp->final();
+    covp->sampleCb(0, nullptr, nullptr);
+    printf("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,32 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2026 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+
+test.compile(verilator_flags2=['--cc --coverage-toggle'])
+
+test.execute()
+
+
+def check(point, count):
+    test.file_grep(test.obj_dir + "/coverage.dat",
+                   r"\x01o\x02" + re.escape(point) + r"\x01h\x02[^']*' " + str(count) + "$")
+
+
+# 10 increments to 'b1010, in each of 8 instances
+check("value[0]:0->1", 40)
+check("value[0]:1->0", 40)
+check("value[1]:0->1", 24)
+check("value[1]:1->0", 16)
+check("value[3]:0->1", 8)
+check("value[3]:1->0", 0)
+
+test.passes()
@@ -0,0 +1,45 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+
+   input clk;
+
+   integer cyc = 0;
+
+   always @ (posedge clk) begin
+      cyc <= cyc + 1;
+      if (cyc == 30) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+
+   // Identical instances share one coverage table and their counts
+   for (genvar i = 0; i < 8; ++i) begin : gen
+      sub u_sub (.clk, .cyc);
+   end
+
+endmodule
+
+module sub (/*AUTOARG*/
+   // Inputs
+   clk, cyc
+   );
+
+   input clk;
+   input integer cyc;
+
+   logic [3:0] value = '0;
+
+   always @ (posedge clk) begin
+      if (cyc < 20 && cyc[0]) value <= value + 1;
+   end
+
+endmodule
@@ -0,0 +1,41 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2026 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+
+test.compile(verilator_flags2=['--cc --coverage-toggle --coverage-max-width 1024'])
+
+test.execute()
+
+
+def check(point, count):
+    test.file_grep(test.obj_dir + "/coverage.dat",
+                   r"\x01o\x02" + re.escape(point) + r"\x01h\x02top\.t' " + str(count) + "$")
+
+
+# 10 inversions of every bit
+for bit in (0, 31, 32, 1023):
+    check("wide[" + str(bit) + "]:0->1", 5)
+    check("wide[" + str(bit) + "]:1->0", 5)
+
+# Counted from 0 to 100 = 'b1100100
+for name in ("count", "quad", "narrow"):
+    check(name + "[0]:0->1", 50)
+    check(name + "[0]:1->0", 50)
+    check(name + "[1]:0->1", 25)
+    check(name + "[5]:0->1", 2)
+    check(name + "[5]:1->0", 1)
+    check(name + "[6]:0->1", 1)
+    check(name + "[6]:1->0", 0)
+    check(name + "[11]:0->1", 0)
+check("count[299]:0->1", 0)
+
+test.passes()
@@ -0,0 +1,35 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+
+   input clk;
+
+   integer cyc = 0;
+
+   logic [1023:0] wide = '0;  // All bits toggle together
+   logic [299:0] count = '0;  // Few bits toggle per cycle
+   logic [47:0] quad = '0;
+   logic [11:0] narrow = '0;
+
+   always @ (posedge clk) begin
+      cyc <= cyc + 1;
+      if (cyc < 10) wide <= ~wide;
+      if (cyc < 100) begin
+         count <= count + 1;
+         quad <= quad + 1;
+         narrow <= narrow + 1;
+      end
+      if (cyc == 110) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+
+endmodule
@@ -0,0 +1,62 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// Copyright 2026 by Wilson Snyder. This program is free software; you can
+// redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include "svdpi.h"
+
+#include <chrono>
+#include <cstdio>
+
+#include "Vt_dpi_arr_zero_copy__Dpi.h"
+
+//======================================================================
+
+#ifdef TEST_BENCHMARK
+static constexpr int N = 1024 * 1024;  // Bytes per array, as in t_dpi_arr_zero_copy.v
+static std::chrono::steady_clock::time_point s_start;
+#else
+static constexpr int N = 1024;
+#endif
+
+void dpii_reverse(const int* in, int* out) {
+    // Reads input elements after writing output ones, so the arguments must
+    // not alias when called with the same variable
+    for (int i = 0; i < 8; ++i) out[i] = in[7 - i];
+}
+
+void dpii_update(const char* in, char* out, int* sums) {
+    for (int i = 0; i < N; ++i) out[i] = in[i] ^ 0x5a;
+    sums[0] += 1;
+    sums[1] += in[0x12];
+}
+
+int dpii_wide(const svBitVecVal* in, svBitVecVal* out, const svBitVecVal* w32,
+              const long long* l, const double* r, const short* s) {
+    for (int i = 0; i < 2 * 3; ++i) out[i] = ~in[i];
+    if (in[0] != 3 || in[1] != 2 || in[2] != 1) return -1;
+    return static_cast<int>(w32[0] + w32[1] + l[0] + l[1] + r[0] + r[1]) + s[0] + s[1];
+}
+
+void dpii_copy(const svBitVecVal* in, svBitVecVal* out, const svLogicVecVal* lg) {
+    // Written values may have bits beyond the width, which are masked
+    for (int i = 0; i < 4; ++i) out[i] = in[i] + 1;
+    if (lg[0].aval != 0x1234 || lg[1].aval != 0x5678) out[0] = 0;
+}
+
+#ifdef TEST_BENCHMARK
+void dpii_bench_start() { s_start = std::chrono::steady_clock::now(); }
+
+void dpii_bench_end(int cycles, int bytes) {
+    using Micro = std::chrono::duration<double, std::micro>;
+    const double us = Micro(std::chrono::steady_clock::now() - s_start).count();
+    printf("%d calls with %d byte arrays: %.1f us/call, %.2f GB/s\n", cycles, bytes,
+           us / cycles, 2.0 * bytes * cycles / us / 1000.0);
+}
+#endif
@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2026 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+
+flags = ["--stats"]
+if test.benchmark:
+    flags += ["-CFLAGS -DTEST_BENCHMARK=" + str(test.benchmark)]
+
+test.compile(v_flags2=["t/" + test.name + ".cpp"], verilator_flags2=flags)
+
+# in, out of dpii_reverse and dpii_update, sums, and the six dpii_wide arguments
+test.file_grep(test.stats, r'Optimizations, DPI arrays passed without copy\s+(\d+)', 11)
+
+test.execute()
+
+test.passes()
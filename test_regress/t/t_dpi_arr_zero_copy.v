@@ -0,0 +1,87 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+
+`ifdef TEST_BENCHMARK
+   localparam N = 1024 * 1024;
+   localparam CYCLES = 100;
+`else
+   localparam N = 1024;
+   localparam CYCLES = 10;
+`endif
+
+   // Layouts matching the canonical DPI layout, passed without a copy
+   import "DPI-C" function void dpii_reverse(input int in[8], output int out[8]);
+   import "DPI-C" function void dpii_update(input byte in[N], output byte out[N],
+                                            inout int sums[2]);
+   import "DPI-C" function int dpii_wide(input bit [95:0] in[2], output bit [95:0] out[2],
+                                         input bit [31:0] w32[2], input longint l[2],
+                                         input real r[2], input shortint s[2]);
+   // Layouts needing conversion, copied
+   import "DPI-C" function void dpii_copy(input bit [7:0] in[4], output bit [7:0] out[4],
+                                          input logic [31:0] lg[2]);
+`ifdef TEST_BENCHMARK
+   import "DPI-C" function void dpii_bench_start();
+   import "DPI-C" function void dpii_bench_end(int cycles, int bytes);
+`endif
+
+   int        a[8];
+   byte       pkt_in[N];
+   byte       pkt_out[N];
+   int        sums[2];
+   bit [95:0] win[2];
+   bit [95:0] wout[2];
+   bit [31:0] w32[2];
+   longint    l[2];
+   real       r[2];
+   shortint   s[2];
+   bit [7:0]  cin[4];
+   bit [7:0]  cout[4];
+   logic [31:0] lg[2];
+
+   initial begin
+      // Same variable as input and output
+      for (int i = 0; i < 8; ++i) a[i] = i;
+      dpii_reverse(a, a);
+      for (int i = 0; i < 8; ++i) if (a[i] != 7 - i) $stop;
+
+      for (int i = 0; i < N; ++i) pkt_in[i] = byte'(i);
+      sums = '{0, 0};
+`ifdef TEST_BENCHMARK
+      dpii_bench_start();
+`endif
+      for (int cyc = 0; cyc < CYCLES; ++cyc) begin
+         dpii_update(pkt_in, pkt_out, sums);
+      end
+`ifdef TEST_BENCHMARK
+      dpii_bench_end(CYCLES, N);
+`endif
+      if (pkt_out[0] != 8'h5a) $stop;
+      if (pkt_out[N - 1] != (8'hff ^ 8'h5a)) $stop;
+      if (sums[0] != CYCLES) $stop;
+      if (sums[1] != CYCLES * 8'h12) $stop;
+
+      win[0] = 96'h1_00000002_00000003;
+      win[1] = 96'hffffffff_00000000_ffffffff;
+      w32 = '{32'd1, 32'd2};
+      l = '{64'd3, 64'd4};
+      r = '{5.0, 6.0};
+      s = '{16'sd7, -16'sd8};
+      if (dpii_wide(win, wout, w32, l, r, s) != 1 + 2 + 3 + 4 + 5 + 6 + 7 - 8) $stop;
+      if (wout[0] != ~win[0]) $stop;
+      if (wout[1] != ~win[1]) $stop;
+
+      cin = '{8'h01, 8'h02, 8'h7f, 8'hff};
+      lg = '{32'h1234, 32'h5678};
+      dpii_copy(cin, cout, lg);
+      if (cout[0] != 8'h02 || cout[2] != 8'h80 || cout[3] != 8'h00) $stop;
+
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+
+endmodule
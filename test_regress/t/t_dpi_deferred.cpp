@@ -0,0 +1,50 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// Copyright 2026 by Wilson Snyder. This program is free software; you can
+// redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include "svdpi.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "Vt_dpi_deferred__Dpi.h"
+
+//======================================================================
+
+static int s_count = 0;  // Deferred calls made
+
+static void check(bool ok, const char* what, int cyc) {
+    if (ok) return;
+    printf("%%Error: %s: cyc=%d count=%d\n", what, cyc, s_count);
+    exit(1);
+}
+
+void dpii_log(int cyc, int value) {
+    // Calls are made in the order queued
+    check(s_count % 3 != 2 && s_count / 3 == cyc, "dpii_log order", cyc);
+    check(value == cyc * 10 + s_count % 3, "dpii_log value", cyc);
+    ++s_count;
+}
+
+int dpii_log_wide(const svBitVecVal* w, const int* arr, const char* s) {
+    const int cyc = s_count / 3;
+    check(s_count % 3 == 2, "dpii_log_wide order", cyc);
+    check(w[0] == static_cast<svBitVecVal>(cyc) && w[1] == 0x12345678
+              && w[2] == static_cast<svBitVecVal>(cyc),
+          "dpii_log_wide w", cyc);
+    check(arr[0] == cyc && arr[1] == cyc + 1 && arr[2] == cyc + 2, "dpii_log_wide arr", cyc);
+    check(std::string{s} == "c" + std::to_string(cyc), "dpii_log_wide s", cyc);
+    ++s_count;
+    return 0;
+}
+
+int dpii_count() { return s_count; }
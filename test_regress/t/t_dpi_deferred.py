@@ -0,0 +1,31 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2026 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+
+test.compile(v_flags2=["t/" + test.name + ".cpp", "t/" + test.name + ".vlt"])
+
+# Calls are made on a separate thread when the model is multithreaded
+async_calls = 'true' if test.threads > 1 else 'false'
+test.file_grep(test.obj_dir + "/" + test.vm_prefix + "__Syms.h",
+               r'VlDpiDeferred __Vm_dpiDeferred\{' + async_calls + r'\}')
+
+# Only with a worker thread do other imports need to wait for deferred calls
+files = test.glob_some(test.obj_dir + "/" + test.vm_prefix + "*.cpp")
+if test.threads > 1:
+    test.file_grep_any(files, r'__Vm_dpiDeferred\.wait\(\);')
+else:
+    for filename in files:
+        test.file_grep_not(filename, r'__Vm_dpiDeferred\.wait\(\);')
+
+test.execute()
+
+test.passes()
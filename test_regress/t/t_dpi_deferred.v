@@ -0,0 +1,46 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (  /*AUTOARG*/
+    // Inputs
+    clk
+);
+   input clk;
+
+   // Deferred by t_dpi_deferred.vlt
+   import "DPI-C" function void dpii_log(input int cyc, input int value);
+   import "DPI-C" task dpii_log_wide(input bit [95:0] w, input int arr[3], input string s);
+   // Not deferred, waits for any deferred calls still running
+   import "DPI-C" function int dpii_count();
+
+   int cyc = 0;
+   int value;
+   bit [95:0] w;
+   int arr[3];
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      // Deferred calls are made at the end of each eval, so all earlier cycles' calls are done
+      if (dpii_count() != cyc * 3) begin
+         $display("%%Error: cyc=%0d count=%0d", cyc, dpii_count());
+         $stop;
+      end
+      // Inputs are copied when the call is queued
+      value = cyc * 10;
+      dpii_log(cyc, value);
+      value = -1;
+      dpii_log(cyc, cyc * 10 + 1);
+      w = {cyc, 32'h12345678, cyc};
+      arr = '{cyc, cyc + 1, cyc + 2};
+      dpii_log_wide(w, arr, $sformatf("c%0d", cyc));
+      w = '0;
+      arr = '{default: 0};
+      if (cyc == 20) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
@@ -0,0 +1,23 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+   import "DPI-C" function int dpii_ret(input int a);
+   import "DPI-C" function void dpii_out(input int a, output int b);
+   import "DPI-C" context function void dpii_ctx(input int a);
+   function void vlog(input int a);
+      $display("%0d", a);
+   endfunction
+
+   int b;
+
+   initial begin
+      b = dpii_ret(1);
+      dpii_out(1, b);
+      dpii_ctx(b);
+      vlog(b);
+   end
+endmodule
@@ -0,0 +1,108 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// Copyright 2026 by Wilson Snyder. This program is free software; you can
+// redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include "verilated.h"
+
+#include "svdpi.h"
+
+#include <cstdio>
+#include <memory>
+
+#ifdef TEST_BENCHMARK
+#include <chrono>
+#endif
+
+#include "Vt_dpi_export_direct.h"
+#include "Vt_dpi_export_direct__Dpi.h"
+#include "Vt_dpi_export_direct__Dpi_Direct.h"
+
+//======================================================================
+
+#define CHECK_RESULT(got, exp) \
+    if ((got) != (exp)) { \
+        printf("%%Error: %s:%d: GOT = %d   EXP = %d\n", __FILE__, __LINE__, \
+               static_cast<int>(got), static_cast<int>(exp)); \
+        return 1; \
+    }
+
+#ifdef TEST_BENCHMARK
+static double nsPerCall(std::chrono::steady_clock::time_point start, int calls) {
+    const std::chrono::duration<double, std::nano> elapsed
+        = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / calls;
+}
+#endif
+
+int dpii_scope_id() {
+    // Context import, called by dpix_scope
+    const svScope scope = svGetScope();
+    if (scope == svGetScopeFromName("t.a")) return 1;
+    if (scope == svGetScopeFromName("t.b")) return 2;
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<Vt_dpi_export_direct> topp{
+        new Vt_dpi_export_direct{contextp.get(), ""}};
+    topp->eval();
+
+    svBitVecVal w[3] = {1, 2, 3};
+    svBitVecVal wo[3] = {0, 0, 0};
+
+    // Direct entry points, each for one scope
+    CHECK_RESULT(Vt_dpi_export_direct__dpix__t__a__dpix_add(topp.get(), 5, w, wo), 105);
+    CHECK_RESULT(wo[0], 101);
+    CHECK_RESULT(wo[1], 2);
+    CHECK_RESULT(wo[2], 3);
+    CHECK_RESULT(Vt_dpi_export_direct__dpix__t__b__dpix_add(topp.get(), 6, w, wo), 206);
+    CHECK_RESULT(wo[0], 201);
+    CHECK_RESULT(Vt_dpi_export_direct__dpix__t__a__dpix_count(topp.get()), 1);
+    CHECK_RESULT(Vt_dpi_export_direct__dpix__t__b__dpix_count(topp.get()), 1);
+
+    // Standard DPI path updates the same instance
+    svSetScope(svGetScopeFromName("t.b"));
+    CHECK_RESULT(dpix_add(7, w, wo), 207);
+    CHECK_RESULT(Vt_dpi_export_direct__dpix__t__b__dpix_count(topp.get()), 2);
+    CHECK_RESULT(dpix_count(), 2);
+
+    // Direct entry points set the scope, as svSetScope() would
+    svSetScope(svGetScopeFromName("t.a"));
+    CHECK_RESULT(Vt_dpi_export_direct__dpix__t__b__dpix_count(topp.get()), 2);
+    CHECK_RESULT(svGetScope() == svGetScopeFromName("t.b"), true);
+    CHECK_RESULT(Vt_dpi_export_direct__dpix__t__a__dpix_scope(topp.get()), 1);
+    CHECK_RESULT(Vt_dpi_export_direct__dpix__t__b__dpix_scope(topp.get()), 2);
+
+#ifdef TEST_BENCHMARK
+    // Benchmark the two paths, with --benchmark <calls>
+    constexpr int CALLS = TEST_BENCHMARK;
+    int sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < CALLS; ++i) {
+        svSetScope(svGetScopeFromName("t.a"));
+        sum += dpix_add(i, w, wo);
+    }
+    const double standardNs = nsPerCall(start, CALLS);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < CALLS; ++i) {
+        sum -= Vt_dpi_export_direct__dpix__t__a__dpix_add(topp.get(), i, w, wo);
+    }
+    const double directNs = nsPerCall(start, CALLS);
+    CHECK_RESULT(sum, 0);
+    CHECK_RESULT(Vt_dpi_export_direct__dpix__t__a__dpix_count(topp.get()), 1 + 2 * CALLS);
+    printf("Export call: standard %.1f ns, direct %.1f ns\n", standardNs, directNs);
+#endif
+
+    topp->final();
+    printf("*-* All Finished *-*\n");
+    return 0;
+}
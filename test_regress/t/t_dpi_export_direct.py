@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2026 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+
+flags = ["--exe --dpi-export-direct", test.pli_filename]
+if test.benchmark:
+    flags += ["-CFLAGS -DTEST_BENCHMARK=" + str(test.benchmark)]
+
+test.compile(make_top_shell=False, make_main=False, verilator_flags2=flags)
+
+test.file_grep(test.obj_dir + "/" + test.vm_prefix + "__Dpi_Direct.h",
+               r'int Vt_dpi_export_direct__dpix__t__a__dpix_add\(Vt_dpi_export_direct\* modelp')
+
+test.execute()
+
+test.passes()
@@ -0,0 +1,34 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+   sub #(.BASE(100)) a ();
+   sub #(.BASE(200)) b ();
+endmodule
+
+module sub #(
+    parameter int BASE = 0
+);
+   int count = 0;
+
+   export "DPI-C" function dpix_add;
+   function int dpix_add(input int v, input bit [95:0] w, output bit [95:0] wo);
+      count += 1;
+      wo = w + 96'(BASE);
+      return BASE + v;
+   endfunction
+
+   export "DPI-C" function dpix_count;
+   function int dpix_count();
+      return count;
+   endfunction
+
+   import "DPI-C" context function int dpii_scope_id();
+   export "DPI-C" function dpix_scope;
+   function int dpix_scope();
+      return dpii_scope_id();
+   endfunction
+endmodule
@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2026 by Wilson Snyder. This program is free software; you can
+# redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import glob
+import os
+import time
+
+import vltest_bootstrap
+
+test.priority(30)
+test.scenarios('vlt_all')
+
+# stats will be deleted but generation will be skipped if libs of hierarchical blocks exist.
+test.clean_objs()
+
+# Build from a copy, as the source is edited below
+test.top_filename = test.obj_dir + "/t_hier_block.v"
+test.file_sed("t/t_hier_block.v", test.top_filename, lambda contents: contents)
+
+
+def compile_and_run():
+    test.compile(
+        v_flags2=['t/t_hier_block.cpp'],
+        verilator_flags2=[
+            '--stats',
+            '--hierarchical',
+            '--hierarchical-dlopen',
+            '--Wno-TIMESCALEMOD',  #
+            '-GPARAM_A=100',
+            '-pvalue+PARAM_B=200',
+            '-DPARAM_OVERRIDE',  #
+            '--CFLAGS',
+            '"-pipe -DCPP_MACRO=cplusplus"'
+        ],
+        threads=(6 if test.vltmt else 1))
+    test.execute()
+
+
+def file_times():
+    filenames = glob.glob(test.obj_dir + "/V*/lib*.so")
+    filenames.append(test.obj_dir + "/" + test.vm_prefix)
+    return {filename: os.path.getmtime(filename) for filename in filenames}
+
+
+compile_and_run()
+
+# Blocks are in shared libraries, their archives only have the loaders
+test.file_grep(test.obj_dir + "/Vsub0/sub0__Dlopen.cpp", r'dlopen\(')
+if not os.path.exists(test.obj_dir + "/Vsub0/libsub0.so"):
+    test.error("Shared library of hierarchical block not built")
+test.file_grep(test.obj_dir + "/" + test.vm_prefix + ".mk", r'-rdynamic')
+test.file_grep(test.stats, r'HierBlock,\s+Hierarchical blocks\s+(\d+)', 14)
+test.file_grep(test.run_log_filename, r'MACRO:(\S+) is defined', "cplusplus")
+
+# Editing one block rebuilds only that block's shared library, and does not relink the top
+old_times = file_times()
+time.sleep(2)  # Or else it might take < 1 second to compile and see no diff.
+test.file_sed(
+    test.top_filename, test.top_filename, lambda contents: contents.replace(
+        "   always_ff @(posedge clk) ff <= in + 1;\n",
+        "   always_ff @(posedge clk) ff <= in + 1;\n   initial $display(\"sub1 rebuilt\");\n", 1))
+compile_and_run()
+
+new_times = file_times()
+for filename, old_time in sorted(old_times.items()):
+    changed = new_times[filename] != old_time
+    if changed != filename.endswith("/libsub1.so"):
+        test.error(("Rebuilt " if changed else "Did not rebuild ") + filename)
+with open(test.run_log_filename, 'r', encoding='latin-1') as fh:
+    if "sub1 rebuilt" not in fh.read():
+        test.error("Edited block not reloaded")
+
+# After moving the object directory, the libraries are only found through the environment
+moved_dir = test.obj_dir + "/moved"
+for filename in glob.glob(test.obj_dir + "/V*/lib*.so"):
+    block_dir = moved_dir + "/" + os.path.basename(os.path.dirname(filename))
+    os.makedirs(block_dir, exist_ok=True)
+    os.rename(filename, block_dir + "/" + os.path.basename(filename))
+test.execute(fails=True)
+test.file_grep(test.run_log_filename, r'%Error: cannot load \w+ library')
+test.execute(run_env="VERILATOR_HIER_DLOPEN_DIR=" + moved_dir)
+
+test.passes()
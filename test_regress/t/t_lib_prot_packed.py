@@ -0,0 +1,46 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2026 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+
+test.cycles = (int(test.benchmark) if test.benchmark else 100)
+test.sim_time = test.cycles * 100
+
+secret_prefix = "secret"
+secret_dir = test.obj_dir + "/" + secret_prefix
+test.mkdir_ok(secret_dir)
+
+test.run(logfile=secret_dir + "/vlt_compile.log",
+         cmd=[
+             "perl", os.environ["VERILATOR_ROOT"] + "/bin/verilator", "-cc", "--prefix",
+             "Vt_lib_prot_secret", "-Mdir", secret_dir, "--lib-create", secret_prefix,
+             "t/t_lib_prot_packed.v"
+         ],
+         verilator_run=True)
+
+test.run(logfile=secret_dir + "/secret_gcc.log",
+         cmd=[os.environ["MAKE"], "-C", secret_dir, "-f", "Vt_lib_prot_secret.mk"])
+
+# All data ports are packed, so each update passes one input and one output vector,
+# with each port starting on a word boundary
+test.file_grep(secret_dir + "/secret.sv", r'input \w+ \[223:0\] inputs__V')
+test.file_grep(secret_dir + "/secret.sv", r'output \w+ \[255:0\] outputs__V')
+test.file_grep(secret_dir + "/secret.sv", r"\{q, 31'b0, e, 31'b0, d, 25'b0, b\}")
+test.file_grep(secret_dir + "/secret.cpp", r'm_comboInputs__V')
+
+test.compile(verilator_flags2=[
+    secret_dir + "/secret.sv", "+define+PROCESS_TOP", "+define+SIM_CYCLES=" +
+    str(test.cycles), "-LDFLAGS", secret_prefix + "/libsecret.a"
+])
+
+test.execute()
+
+test.passes()
@@ -0,0 +1,87 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`ifdef PROCESS_TOP
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   localparam last_cyc = `SIM_CYCLES;
+
+   integer cyc = 0;
+   logic [6:0] b = 0;
+   logic [32:0] d = 0;
+   logic [64:0] e = 0;
+   logic [3:0][7:0] q = 0;
+   logic [31:0] count_ref = 0;
+
+   wire [6:0] b_out;
+   wire [32:0] d_out;
+   wire [64:0] e_out;
+   wire [3:0][7:0] q_out;
+   wire [31:0] count;
+`ifdef TEST_MIXED
+   real r = 1.0;
+`endif
+
+   secret i_secret(.*);
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      count_ref <= count_ref + {25'b0, b};
+      if (cyc > 1) begin
+         `checkh(b_out, ~b);
+         `checkh(d_out, d + 33'd1);
+         `checkh(e_out, {e[0], e[64:1]});
+         `checkh(q_out, {q[0], q[3:1]});
+         `checkh(count, count_ref);
+      end
+      // Inputs change on only some cycles, so most combo updates are skipped
+      if (cyc % 4 == 0) begin
+         b <= b + 7'd3;
+         d <= {d[31:0], d[32]} ^ 33'h1;
+         e <= e + 65'h1_0000_0001_0000_0001;
+         q <= q + 32'h0101_0101;
+      end
+      if (cyc == last_cyc) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
+
+`else
+module secret (
+   input clk,
+`ifdef TEST_MIXED
+   // Passed individually, so updates always evaluate
+   input real r,
+`endif
+   input [6:0] b,
+   input [32:0] d,
+   input [64:0] e,
+   input [3:0][7:0] q,
+   output [6:0] b_out,
+   output [32:0] d_out,
+   output [64:0] e_out,
+   output [3:0][7:0] q_out,
+   output logic [31:0] count
+);
+   initial count = 0;
+
+   assign b_out = ~b;
+   assign d_out = d + 33'd1;
+   assign e_out = {e[0], e[64:1]};
+   assign q_out = {q[0], q[3:1]};
+
+   always @(posedge clk) count <= count + {25'b0, b};
+endmodule
+`endif
@@ -0,0 +1,48 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2026 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+test.top_filename = "t/t_lib_prot_packed.v"
+
+# With --benchmark, compare run time against t_lib_prot_packed, which skips unchanged updates
+test.cycles = (int(test.benchmark) if test.benchmark else 100)
+test.sim_time = test.cycles * 100
+
+secret_prefix = "secret"
+secret_dir = test.obj_dir + "/" + secret_prefix
+test.mkdir_ok(secret_dir)
+
+test.run(logfile=secret_dir + "/vlt_compile.log",
+         cmd=[
+             "perl", os.environ["VERILATOR_ROOT"] + "/bin/verilator", "-cc", "--prefix",
+             "Vt_lib_prot_secret", "-Mdir", secret_dir, "--lib-create", secret_prefix,
+             "+define+TEST_MIXED", test.top_filename
+         ],
+         verilator_run=True)
+
+test.run(logfile=secret_dir + "/secret_gcc.log",
+         cmd=[os.environ["MAKE"], "-C", secret_dir, "-f", "Vt_lib_prot_secret.mk"])
+
+# The real input is passed individually, and the other ports still packed, but as not
+# all inputs are in the vector, updates always evaluate
+test.file_grep(secret_dir + "/secret.sv", r'real r\b')
+test.file_grep(secret_dir + "/secret.sv", r'input \w+ \[223:0\] inputs__V')
+test.file_grep(secret_dir + "/secret.sv", r'output \w+ \[255:0\] outputs__V')
+test.file_grep_not(secret_dir + "/secret.cpp", r'm_comboInputs__V')
+
+test.compile(verilator_flags2=[
+    secret_dir + "/secret.sv", "+define+PROCESS_TOP", "+define+TEST_MIXED",
+    "+define+SIM_CYCLES=" + str(test.cycles), "-LDFLAGS", secret_prefix + "/libsecret.a"
+])
+
+test.execute()
+
+test.passes()
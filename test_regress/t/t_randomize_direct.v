@@ -0,0 +1,99 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkd(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0d exp=%0d\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+`define checkrange(gotv,minv,maxv) do if ((gotv) < (minv) || (gotv) > (maxv)) begin $write("%%Error: %s:%0d:  got=%0d exp=%0d-%0d\n", `__FILE__,`__LINE__, (gotv), (minv), (maxv)); `stop; end while(0);
+
+// a, b and c are each only compared to constants, so sampled without the solver
+class Direct;
+   rand bit [7:0] a;
+   rand int b;
+   rand bit [3:0] c;
+   rand bit [7:0] d;
+   rand bit [7:0] e;
+
+   constraint c_a { a inside {[10:20], 50}; a != 15; }
+   constraint c_b { b >= -5; b < 5; }
+   constraint c_c { c dist { 0 := 1, [1:3] :/ 3 }; }
+   constraint c_de { d < e; }
+endclass
+
+// a is sampled, but the solver fails, so a is kept
+class Unsat;
+   rand bit [7:0] a;
+   rand bit [7:0] d;
+   rand bit [7:0] e;
+
+   constraint c_a { a > 100; }
+   constraint c_de { d < e; d > e; }
+endclass
+
+// rand_mode is used, so the solver is kept
+class RandMode;
+   rand bit [7:0] a;
+
+   constraint c_a { a inside {[10:20]}; }
+endclass
+
+// Randomized with inline constraints, so the solver is kept
+class With;
+   rand bit [7:0] a;
+
+   constraint c_a { a inside {[10:20]}; }
+endclass
+
+module t;
+   Direct direct;
+   Unsat unsat;
+   RandMode randMode;
+   With with_;
+   int fifties = 0;
+   int bs[int];
+   int zeros = 0;
+
+   initial begin
+      direct = new;
+      for (int i = 0; i < 1000; ++i) begin
+         `checkd(direct.randomize(), 1);
+         if (!(direct.a inside {[10:14], [16:20], 50})) $stop;
+         `checkrange(direct.b, -5, 4);
+         `checkrange(direct.c, 0, 3);
+         if (direct.d >= direct.e) $stop;
+         if (direct.a == 50) ++fifties;
+         bs[direct.b] = 1;
+         if (direct.c == 0) ++zeros;
+      end
+      // Each of 11 values of a equally likely
+      `checkrange(fifties, 40, 140);
+      `checkd(bs.num(), 10);
+      // Weight 1 of 4
+      `checkrange(zeros, 150, 350);
+
+      unsat = new;
+      unsat.a = 7;
+      `checkd(unsat.randomize(), 0);
+      `checkd(unsat.a, 7);
+
+      randMode = new;
+      randMode.a = 7;
+      randMode.a.rand_mode(0);
+      `checkd(randMode.randomize(), 1);
+      `checkd(randMode.a, 7);
+      randMode.a.rand_mode(1);
+      `checkd(randMode.randomize(), 1);
+      `checkrange(randMode.a, 10, 20);
+
+      with_ = new;
+      for (int i = 0; i < 20; ++i) begin
+         `checkd(with_.randomize() with { a > 15; }, 1);
+         `checkrange(with_.a, 16, 20);
+      end
+
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
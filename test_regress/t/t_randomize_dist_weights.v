@@ -0,0 +1,63 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkd(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0d exp=%0d\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+`define checkrange(gotv,minv,maxv) do if ((gotv) < (minv) || (gotv) > (maxv)) begin $write("%%Error: %s:%0d:  got=%0d exp=%0d-%0d\n", `__FILE__,`__LINE__, (gotv), (minv), (maxv)); `stop; end while(0);
+
+typedef enum bit [1:0] {READ, WRITE, IDLE, RESET} op_t;
+
+class Txn;
+   rand op_t op;
+   rand bit [15:0] addr;
+   rand int delta;
+   rand bit [31:0] id;
+
+   constraint c_op { op dist { READ := 1, WRITE := 3, IDLE := 6 }; }
+   constraint c_addr { addr dist { [0:99] :/ 1, [1000:1099] :/ 3 }; }
+   constraint c_delta { delta dist { [-10:-1] := 1, 0 := 0, [1:10] := 3 }; }
+   constraint c_id { id inside {[100:199], 1000, 2000, [3000:3999], 5000}; }
+endclass
+
+module t;
+   localparam int N =
+`ifdef BENCHMARK_N
+              `BENCHMARK_N;
+`else
+   4000;
+`endif
+
+   Txn txn;
+   int ops[4];
+   int highAddrs = 0;
+   int positives = 0;
+   int ids = 0;
+
+   initial begin
+      txn = new;
+      for (int i = 0; i < N; ++i) begin
+         `checkd(txn.randomize(), 1);
+         if (!((txn.addr < 100) || (txn.addr >= 1000 && txn.addr < 1100))) $stop;
+         if (txn.delta < -10 || txn.delta > 10 || txn.delta == 0) $stop;
+         if (!(txn.id inside {[100:199], 1000, 2000, [3000:3999], 5000})) $stop;
+         ++ops[txn.op];
+         if (txn.addr >= 1000) ++highAddrs;
+         if (txn.delta > 0) ++positives;
+         if (txn.id >= 3000 && txn.id < 4000) ++ids;
+      end
+      // Values are chosen in proportion to their weights
+      `checkd(ops[RESET], 0);
+      `checkrange(ops[READ], N / 20, N * 3 / 20);
+      `checkrange(ops[WRITE], N * 4 / 20, N * 8 / 20);
+      `checkrange(ops[IDLE], N * 10 / 20, N * 14 / 20);
+      `checkrange(highAddrs, N * 13 / 20, N * 17 / 20);
+      `checkrange(positives, N * 13 / 20, N * 17 / 20);
+      // Inside sets are uniform over their values
+      `checkrange(ids, N * 14 / 20, N * 19 / 20);
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
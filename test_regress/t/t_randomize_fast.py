@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2026 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+
+# Run with --benchmark 1000000 for randomization throughput
+test.compile(verilator_flags2=['-Wno-CONSTRAINTIGN'])
+
+# All constraints are solved in-process, so no external solver is needed
+test.execute(run_env='VERILATOR_SOLVER=someimaginarysolver')
+
+if test.have_solver:
+    test.execute(all_run_flags=['+verilator+solver+fast+0'])
+
+test.passes()
@@ -0,0 +1,86 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkd(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0d exp=%0d\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+
+typedef enum bit [1:0] {READ, WRITE, IDLE, RESET} op_t;
+
+class Txn;
+   rand op_t op;
+   rand bit [31:0] addr;
+   rand bit [7:0] len;
+   rand bit [31:0] last;
+   rand int delta;
+   rand bit [3:0] kind;
+   rand bit enable;
+   rand byte unsigned burst;
+
+   constraint c_op { op != RESET; }
+   constraint c_addr { addr inside {[32'h1000:32'h1fff], [32'h8000:32'h80ff]}; addr[1:0] == 0; }
+   constraint c_len { len > 0; len <= 16; }
+   constraint c_last { last == addr + 32'(len) * 4 - 4; }
+   constraint c_delta { delta >= -8; delta < 8; delta != 0; }
+   constraint c_kind { kind dist { 0 := 1, [4:6] :/ 3, 9 := 0 }; }
+   constraint c_imp { op == IDLE -> len == 1; op == WRITE -> addr < 32'h2000; }
+   constraint c_enable { enable; }
+   constraint c_burst { burst inside {1, 2, 4, 8}; (burst > 2) -> (len >= 8); }
+endclass
+
+module t;
+   localparam int N =
+`ifdef TEST_BENCHMARK
+              `TEST_BENCHMARK;
+`else
+   2000;
+`endif
+
+   Txn txn;
+   int ops[4];
+   int kinds[16];
+   int negatives = 0;
+
+   initial begin
+      txn = new;
+      for (int i = 0; i < N; ++i) begin
+         `checkd(txn.randomize(), 1);
+         if (txn.op == RESET) $stop;
+         if (!((txn.addr >= 32'h1000 && txn.addr <= 32'h1fff)
+               || (txn.addr >= 32'h8000 && txn.addr <= 32'h80ff))) $stop;
+         `checkd(txn.addr[1:0], 0);
+         if (txn.len == 0 || txn.len > 16) $stop;
+         `checkd(txn.last, txn.addr + 32'(txn.len) * 4 - 4);
+         if (txn.delta < -8 || txn.delta >= 8 || txn.delta == 0) $stop;
+         if (!(txn.kind == 0 || (txn.kind >= 4 && txn.kind <= 6))) $stop;
+         if (txn.op == IDLE && txn.len != 1) $stop;
+         if (txn.op == WRITE && txn.addr >= 32'h2000) $stop;
+         `checkd(txn.enable, 1'b1);
+         if (!(txn.burst inside {1, 2, 4, 8})) $stop;
+         if (txn.burst > 2 && txn.len < 8) $stop;
+         ++ops[txn.op];
+         ++kinds[txn.kind];
+         if (txn.delta < 0) ++negatives;
+      end
+      // All allowed values are produced
+      if (ops[READ] == 0 || ops[WRITE] == 0 || ops[IDLE] == 0) $stop;
+      if (kinds[0] == 0 || kinds[4] == 0 || kinds[5] == 0 || kinds[6] == 0) $stop;
+      if (negatives == 0 || negatives == N) $stop;
+
+      // Inline constraints and rand_mode
+      txn.len.rand_mode(0);
+      txn.len = 12;
+      `checkd(txn.randomize() with { addr == 32'h8010; }, 1);
+      `checkd(txn.len, 12);
+      `checkd(txn.addr, 32'h8010);
+      `checkd(txn.last, 32'h8010 + 12 * 4 - 4);
+
+      // Unsatisfiable
+      `checkd(txn.randomize() with { delta > 100; }, 0);
+
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
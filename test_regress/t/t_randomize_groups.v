@@ -0,0 +1,77 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkd(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0d exp=%0d\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+
+class Pkt;
+   rand bit [7:0] a;
+   rand bit [15:0] b;
+   rand bit [15:0] c;
+   rand bit [3:0] d;
+
+   // Groups: {a}, {b, c}, {d}
+   constraint c_a { a inside {[10:20]}; }
+   constraint c_bc { b < 1000; c == b + 1; }
+   constraint c_d { if (d[0]) d < 8; }
+endclass
+
+class Derived extends Pkt;
+   rand bit [7:0] e;
+
+   // Joins a with e, for this class only
+   constraint c_e { e > a; e < 30; }
+endclass
+
+module t;
+   Pkt p;
+   Derived q;
+   bit [7:0] a_min, a_max;
+
+   initial begin
+      p = new;
+      q = new;
+      a_min = 255;
+      a_max = 0;
+      repeat (200) begin
+         `checkd(p.randomize(), 1);
+         `checkd(p.a inside {[10:20]}, 1);
+         `checkd(p.b < 1000, 1);
+         `checkd(p.c, p.b + 1);
+         if (p.d[0]) `checkd(p.d < 8, 1);
+         if (p.a < a_min) a_min = p.a;
+         if (p.a > a_max) a_max = p.a;
+
+         `checkd(q.randomize(), 1);
+         `checkd(q.a inside {[10:20]}, 1);
+         `checkd(q.e > q.a && q.e < 30, 1);
+         `checkd(q.c, q.b + 1);
+
+         // Inline constraint joins groups {a} and {d}
+         `checkd(p.randomize() with { d == a[3:0]; }, 1);
+         `checkd(p.d, p.a[3:0]);
+         `checkd(p.a inside {[10:20]}, 1);
+      end
+      // Sampled across the whole range
+      `checkd(a_min, 10);
+      `checkd(a_max, 20);
+
+      // A fixed variable is a constant of its group
+      p.b.rand_mode(0);
+      p.b = 16'd500;
+      `checkd(p.randomize(), 1);
+      `checkd(p.c, 16'd501);
+
+      // Unsatisfiable group fails the whole randomize, leaving other groups alone
+      p.b = 16'd2000;
+      p.a = 8'd1;
+      `checkd(p.randomize(), 0);
+      `checkd(p.a, 8'd1);
+
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
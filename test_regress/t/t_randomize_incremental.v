@@ -0,0 +1,51 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkd(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0d exp=%0d\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+
+class Wide;
+   int limit = 100;
+   rand bit [31:0] x;
+   rand bit [31:0] y;
+
+   constraint c_x { x < limit; }
+   constraint c_y { y > x; y < 2 * limit; }
+endclass
+
+// Same variable name, different width
+class Narrow;
+   rand bit [7:0] x;
+
+   constraint c_x { x > 8'd200; }
+endclass
+
+module t;
+   Wide w;
+   Narrow n;
+
+   initial begin
+      w = new;
+      n = new;
+      for (int i = 0; i < 20; ++i) begin
+         // State variable changes some constraints between calls
+         w.limit = (i % 4 == 0) ? 10 : 100;
+         `checkd(w.randomize(), 1);
+         `checkd(w.x < w.limit, 1);
+         `checkd(w.y > w.x && w.y < 2 * w.limit, 1);
+         `checkd(w.randomize() with { x == y - 1; }, 1);
+         `checkd(w.x, w.y - 1);
+         `checkd(w.randomize() with { y == 0; }, 0);
+         if (i % 3 == 0) begin
+            `checkd(n.randomize(), 1);
+            `checkd(n.x > 8'd200, 1);
+         end
+      end
+
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
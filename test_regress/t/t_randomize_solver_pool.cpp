@@ -0,0 +1,36 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+//
+
+#include <verilated.h>
+
+#include <memory>
+#include <thread>
+
+#include VM_PREFIX_INCLUDE
+
+// Randomize in two models at once, each from its own thread
+static void sim(VerilatedContext* contextp) {
+    Verilated::threadContextp(contextp);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp}};
+    topp->eval();
+    topp->final();
+}
+
+int main(int argc, char** argv) {
+    std::unique_ptr<VerilatedContext> contextps[2];
+    for (auto& contextp : contextps) {
+        contextp.reset(new VerilatedContext);
+        contextp->commandArgs(argc, argv);
+    }
+    std::thread thread0{sim, contextps[0].get()};
+    std::thread thread1{sim, contextps[1].get()};
+    thread0.join();
+    thread1.join();
+    return 0;
+}
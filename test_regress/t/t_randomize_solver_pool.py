@@ -0,0 +1,56 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2026 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import os
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+
+# Stand-in for an SMT solver, answering sat once per randomization with x of 15,
+# and logging which process answered
+solver = test.obj_dir + "/solver.py"
+solver_log = test.obj_dir + "/solver.log"
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             verilator_flags2=["--exe", test.pli_filename],
+             threads=1)
+
+test.write_wholefile(
+    solver, """#!/usr/bin/env python3
+import os, re, sys, time
+log = open(sys.argv[1], 'a')
+log.write('start %d\\n' % os.getpid())
+log.flush()
+fresh = True
+for line in sys.stdin:
+    l = line.strip()
+    if l.startswith('(pop') or l == '(reset)':
+        fresh = True
+    elif l == '(check-sat)':
+        print('sat' if fresh else 'unsat', flush=True)
+        fresh = False
+    elif l.startswith('(get-value'):
+        time.sleep(0.01)
+        log.write('solve %d\\n' % os.getpid())
+        log.flush()
+        names = re.match(r'\\(get-value \\((.*)\\)\\)', l).group(1).split()
+        print('(' + ' '.join('(%s #x0000000f)' % n for n in names) + ')', flush=True)
+""")
+os.chmod(solver, 0o755)
+
+test.execute(run_env="VERILATOR_SOLVER='" + solver + " " + solver_log + "'",
+             all_run_flags=['+verilator+solver+fast+0', '+verilator+solver+procs+2'])
+
+# Each model's thread used its own solver process
+test.file_grep_count(solver_log, r'start \d+', 2)
+test.file_grep_count(solver_log, r'solve \d+', 20)
+
+test.passes()
@@ -0,0 +1,29 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkd(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0d exp=%0d\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+
+class Item;
+   rand bit [31:0] x;
+
+   constraint c_x { x inside {[10:20]}; }
+endclass
+
+module t;
+   Item item;
+
+   initial begin
+      item = new;
+      repeat (10) begin
+         `checkd(item.randomize(), 1);
+         // Value the stand-in solver always answers
+         `checkd(item.x, 15);
+      end
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
@@ -0,0 +1,203 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// Copyright 2026 by Wilson Snyder. This program is free software; you can
+// redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include "verilated.h"
+#include "verilated_shm.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+#include VM_PREFIX_INCLUDE
+
+//======================================================================
+
+int errors = 0;
+
+static constexpr uint32_t BATCH = 64;  // Cycles per request
+static constexpr int REQUESTS = 100;
+
+// State shared with the server thread.  Its results are checked by the
+// main thread after join, so that only the main thread counts errors.
+struct ServerState final {
+    VM_PREFIX* m_topp;
+    std::string m_filename;
+    uint32_t m_timeoutMs = 10000;  // Server's timeoutMs()
+    std::atomic<bool> m_ready{false};  // Shared memory file created
+    std::atomic<bool> m_hold{false};  // Step waits while set
+    bool m_addResults[4] = {};  // Returns of named addInput/addOutput calls
+    bool m_opened = false;  // isOpen() after open()
+    uint64_t m_cycles = 0;  // Return of serve()
+    uint64_t m_cycle = 0;  // cycle() after serve()
+    bool m_timedOut = false;  // timedOut() after serve()
+};
+
+static void step(void* userp) {
+    ServerState* const statep = static_cast<ServerState*>(userp);
+    while (statep->m_hold.load(std::memory_order_acquire)) std::this_thread::yield();
+    VM_PREFIX* const topp = statep->m_topp;
+    topp->clk = 1;
+    topp->eval();
+    topp->clk = 0;
+    topp->eval();
+    topp->contextp()->timeInc(1);
+}
+
+// Server, constructed in its own thread as it must only be used by one
+static void server(ServerState* statep) {
+    VM_PREFIX* const topp = statep->m_topp;
+    Verilated::threadContextp(topp->contextp());
+    VerilatedShmServer server{topp->contextp()};
+    server.addInput("a", &topp->a, 16);
+    server.addInput("b", &topp->b, 16);
+    statep->m_addResults[0] = server.addInput("t.inc");
+    statep->m_addResults[1] = server.addInput("t.w70");
+    statep->m_addResults[2] = server.addInput("t.count");  // Read-only
+    statep->m_addResults[3] = server.addOutput("t.missing");
+    server.addOutput("sum", &topp->sum, 17);
+    server.addOutput("t.count");
+    server.addOutput("t.w70_inv");
+    server.stepCb(step, statep);
+    server.timeoutMs(statep->m_timeoutMs);
+    server.open(statep->m_filename.c_str(), 8);
+    statep->m_opened = server.isOpen();
+    statep->m_ready.store(true, std::memory_order_release);
+    if (!statep->m_opened) return;
+    statep->m_cycles = server.serve();
+    statep->m_cycle = server.cycle();
+    statep->m_timedOut = server.timedOut();
+    server.close();
+}
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), ""}};
+    topp->clk = 0;
+    topp->eval();
+
+    ServerState state;
+    state.m_topp = topp.get();
+    state.m_filename = contextp->commandArgsPlusMatch("shm+file+") + 10;
+    std::thread serverThread{server, &state};
+    while (!state.m_ready.load(std::memory_order_acquire)) std::this_thread::yield();
+
+    // Out-of-process testbench, here mapping the same file in this thread
+    VerilatedShmClient client;
+    client.open(state.m_filename.c_str());
+    TEST_CHECK_EQ(client.isOpen(), true);
+    if (!client.isOpen()) {
+        serverThread.detach();
+        return 10;
+    }
+    TEST_CHECK_EQ(client.signals(), 7);
+    const int a = client.find("a");
+    const int b = client.find("b");
+    const int inc = client.find("t.inc");
+    const int w70 = client.find("t.w70");
+    const int sum = client.find("sum");
+    const int count = client.find("t.count");
+    const int w70Inv = client.find("t.w70_inv");
+    TEST_CHECK_EQ(client.find("t.missing"), -1);
+    TEST_CHECK_EQ(client.isInput(inc), true);
+    TEST_CHECK_EQ(client.isInput(count), false);
+    TEST_CHECK_EQ(client.bits(w70), 70U);
+
+    // Single cycle, values are masked to their widths
+    client.input(a, 0x1ffff);
+    client.input(b, 2);
+    client.input(inc, 0x13);
+    uint32_t* const w70p = reinterpret_cast<uint32_t*>(client.inputs() + client.offset(w70));
+    w70p[0] = 0x12345678;
+    w70p[2] = 0xff;
+    TEST_CHECK_EQ(client.send(1), true);
+    const VerilatedShmResponse* rspp = client.receive();
+    TEST_CHECK_NZ(rspp);
+    TEST_CHECK_EQ(rspp->m_cycle, 1ULL);
+    TEST_CHECK_EQ(client.output(rspp, sum), 0x10001ULL);
+    TEST_CHECK_EQ(client.output(rspp, count), 3ULL);
+    const uint32_t* const w70Invp
+        = reinterpret_cast<const uint32_t*>(client.values(rspp) + client.offset(w70Inv));
+    TEST_CHECK_EQ(w70Invp[0], ~0x12345678U);
+    TEST_CHECK_EQ(w70Invp[2], 0U);
+    client.release();
+
+    // Batched cycles, keeping the ring full
+    client.input(inc, 1);
+    int sent = 0;
+    for (int received = 0; received < REQUESTS; ++received) {
+        while (sent < REQUESTS && client.send(BATCH)) ++sent;
+        rspp = client.receive();
+        TEST_CHECK_NZ(rspp);
+        TEST_CHECK_EQ(rspp->m_cycle, 1ULL + (received + 1) * BATCH);
+        TEST_CHECK_EQ(client.output(rspp, count), 3ULL + (received + 1) * BATCH);
+        client.release();
+    }
+    const uint64_t cycles = 1ULL + REQUESTS * BATCH + 1;
+
+    // Requests pipelined behind finish() are answered without running.
+    // The server holds in the first request's step until all are queued.
+    state.m_hold.store(true, std::memory_order_release);
+    TEST_CHECK_EQ(client.send(1), true);
+    TEST_CHECK_EQ(client.finish(), true);
+    TEST_CHECK_EQ(client.send(BATCH), true);
+    TEST_CHECK_EQ(client.send(BATCH), true);
+    state.m_hold.store(false, std::memory_order_release);
+    for (int i = 0; i < 4; ++i) {
+        rspp = client.receive();
+        TEST_CHECK_NZ(rspp);
+        TEST_CHECK_EQ(rspp->m_cycle, cycles);
+        TEST_CHECK_EQ(rspp->m_flags, i ? static_cast<uint32_t>(VL_SHM_FINISH) : 0U);
+        client.release();
+    }
+    serverThread.join();
+
+    // The server no longer accepts requests, so the client does not wait
+    TEST_CHECK_EQ(client.send(1), false);
+    TEST_CHECK_Z(client.receive());
+    TEST_CHECK_EQ(client.outstanding(), 0ULL);
+    client.close();
+    TEST_CHECK_EQ(state.m_addResults[0], true);
+    TEST_CHECK_EQ(state.m_addResults[1], true);
+    TEST_CHECK_EQ(state.m_addResults[2], false);
+    TEST_CHECK_EQ(state.m_addResults[3], false);
+    TEST_CHECK_EQ(state.m_opened, true);
+    TEST_CHECK_EQ(state.m_cycles, cycles);
+    TEST_CHECK_EQ(state.m_cycle, cycles);
+    TEST_CHECK_EQ(state.m_timedOut, false);
+
+    // A client that goes away without finish() does not leave the server waiting
+    ServerState goneState;
+    goneState.m_topp = topp.get();
+    goneState.m_filename = state.m_filename + ".gone";
+    goneState.m_timeoutMs = 100;
+    std::thread goneThread{server, &goneState};
+    while (!goneState.m_ready.load(std::memory_order_acquire)) std::this_thread::yield();
+    {
+        VerilatedShmClient gone;
+        TEST_CHECK_EQ(gone.open(goneState.m_filename.c_str()), true);
+        TEST_CHECK_EQ(gone.send(1), true);
+        TEST_CHECK_NZ(gone.receive());
+        gone.release();
+    }
+    goneThread.join();
+    TEST_CHECK_EQ(goneState.m_opened, true);
+    TEST_CHECK_EQ(goneState.m_timedOut, true);
+    TEST_CHECK_EQ(goneState.m_cycles, 1ULL);
+
+    topp->final();
+    printf("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,32 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Outputs
+   sum,
+   // Inputs
+   clk, a, b
+   );
+
+   input clk;
+   input [15:0] a;
+   input [15:0] b;
+   output reg [16:0] sum;
+
+   reg [3:0]  inc /*verilator public_flat_rw*/;
+   reg [31:0] count /*verilator public_flat_rd*/;
+   reg [69:0] w70 /*verilator public_flat_rw*/;
+   reg [69:0] w70_inv /*verilator public_flat_rd*/;
+
+   initial count = 0;
+
+   always @ (posedge clk) begin
+      sum <= a + b;
+      count <= count + {28'h0, inc};
+      w70_inv <= ~w70;
+   end
+
+endmodule
@@ -0,0 +1,69 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkd(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0d exp=%0d\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+
+`timescale 1ns/100ps
+
+module t;
+   // Free-running clock generators, compiled into delay scheduler toggles
+   logic clk_a = 0;
+   always #5 clk_a = ~clk_a;
+   bit clk_b = 1;
+   always #3.5 clk_b = !clk_b;
+
+   // Not a plain clock generator, stays a process
+   logic clk_c = 0;
+   int toggles_c = 0;
+   always #2 begin
+      clk_c = ~clk_c;
+      ++toggles_c;
+   end
+
+   int cyc_a = 0;
+   int cyc_b = 0;
+   int cyc_c = 0;
+   always @(posedge clk_a) ++cyc_a;
+   always @(negedge clk_b) ++cyc_b;
+   always @(posedge clk_c) ++cyc_c;
+
+   // Forced, so stays a process
+   logic clk_d = 0;
+   always #5 clk_d = ~clk_d;
+   initial begin
+      #12 force clk_d = 1;
+      #1 `checkd(clk_d, 1);
+      #9 `checkd(clk_d, 1);
+      release clk_d;
+   end
+
+   // Combinational logic of toggled clocks
+   wire both = clk_a & clk_b;
+   int both_rises = 0;
+   always @(posedge both) ++both_rises;
+
+   initial begin
+      #1;
+      `checkd(clk_a, 0);
+      `checkd(clk_b, 1);
+      #5;
+      `checkd(clk_a, 1);
+      `checkd(clk_b, 0);
+      #93;
+      // Times 5, 15, ... 95
+      `checkd(cyc_a, 10);
+      // Times 3.5, 10.5, ... 94.5
+      `checkd(cyc_b, 14);
+      // Times 2, 6, ... 98
+      `checkd(cyc_c, 25);
+      `checkd(toggles_c, 49);
+      // Times 7, 15, 28, 35, 45, 49, 56, 65, 77, 85, 98
+      `checkd(both_rises, 11);
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
@@ -0,0 +1,43 @@
+// DESCRIPTION: Verilator: Verilog Test module, C driver code
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include "verilated.h"
+
+#include "TestCheck.h"
+#include VM_PREFIX_INCLUDE
+
+int errors = 0;
+
+int main(int argc, char** argv, char**) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get()}};
+
+    topp->go = 0;
+    topp->eval();
+    // Run to time 100, where a process suspends until 105
+    while (contextp->time() < 100) {
+        contextp->time(topp->nextTimeSlot());
+        topp->eval();
+    }
+    TEST_CHECK_EQ(contextp->time(), 100);
+
+    // Move time backwards, a process suspends until 41, which must not resume the other
+    contextp->time(30);
+    topp->go = 1;
+    topp->eval();
+    TEST_CHECK_EQ(topp->nextTimeSlot(), 41);
+
+    while (!contextp->gotFinish() && topp->eventsPending()) {
+        contextp->time(topp->nextTimeSlot());
+        topp->eval();
+    }
+    TEST_CHECK_EQ(contextp->time(), 105);
+    TEST_CHECK_EQ(contextp->gotFinish(), true);
+
+    topp->final();
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,31 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkd(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0d exp=%0d\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+
+`timescale 1ns/1ns
+
+module t(input go);
+   bit late_done = 0;
+
+   // Suspends at time 100 until 105, in the same timing wheel slot as time 41
+   initial begin
+      #100;
+      #5;
+      `checkd($time, 105);
+      `checkd(late_done, 1);
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+
+   // Triggered after the testbench moves time back to 30
+   always @(posedge go) begin
+      #11;
+      `checkd($time, 41);
+      late_done = 1;
+   end
+endmodule
@@ -0,0 +1,49 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkd(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0d exp=%0d\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+
+module t;
+   // Number of concurrent delayed processes
+   localparam int N =
+`ifdef BENCHMARK_N
+              `BENCHMARK_N;
+`else
+   1000;
+`endif
+   localparam int REPEATS = 10;
+
+   int count = 0;
+   longint sum = 0;
+   longint exp_sum = 0;
+   time last = 0;
+
+   // Mix of short and long delays, so several timing wheel levels are used
+   function automatic longint delay_of(int i);
+      return (i % 4 == 3) ? (longint'(i) << 20) + 1 : longint'(i % 97 + 1);
+   endfunction
+
+   initial begin
+      for (int i = 0; i < N; ++i) begin
+         exp_sum += (REPEATS * (REPEATS + 1) / 2) * delay_of(i);
+         fork
+            automatic longint dly = delay_of(i);
+            repeat (REPEATS) begin
+               #(dly);
+               if ($time < last) `stop;
+               last = $time;
+               ++count;
+               sum += $time;
+            end
+         join_none
+      end
+      wait (count == N * REPEATS);
+      `checkd(sum, exp_sum);
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
@@ -0,0 +1,49 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkd(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0d exp=%0d\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+
+`timescale 1ns/1ns
+
+module t;
+   int order[$];
+
+   // Each process suspends at a different time until 4200, so from different timing wheel
+   // levels. Equal times must resume in the order suspended.
+   initial begin
+      #4200;
+      order.push_back(1);
+   end
+   initial begin
+      #1000;
+      #3200;
+      order.push_back(2);
+   end
+   initial begin
+      #4100;
+      #100;
+      order.push_back(3);
+   end
+   initial begin
+      #4160;
+      #40;
+      order.push_back(4);
+   end
+   initial begin
+      #4199;
+      #1;
+      order.push_back(5);
+   end
+
+   initial begin
+      #4201;
+      `checkd(order.size(), 5);
+      foreach (order[i]) `checkd(order[i], i + 1);
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
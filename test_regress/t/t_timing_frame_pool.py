@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2026 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+
+test.compile(verilator_flags2=["--binary", "--timing", "--stats"])
+
+test.file_grep(test.stats, r'Timing, coroutine functions\s+(\d+)')
+test.file_grep(test.stats, r'Timing, coroutine frame hint bytes\s+(\d+)')
+
+test.execute()
+
+test.file_grep(test.run_log_filename, r'coroutine frames \d+ allocated, \d+ reused, \d+ live')
+
+test.passes()
@@ -0,0 +1,43 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkd(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0d exp=%0d\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+
+module t;
+   int sum = 0;
+
+   // Small frame
+   task automatic add(input int value);
+      #1 sum += value;
+   endtask
+
+   // Larger frame, from an unpacked array local
+   task automatic add_many(input int value);
+      int values[64];
+      foreach (values[i]) values[i] = value;
+      #1;
+      foreach (values[i]) sum += values[i];
+   endtask
+
+   initial begin
+      // Sequential calls reuse the same pooled frames
+      for (int i = 0; i < 1000; ++i) add(i);
+      `checkd(sum, 499500);
+      sum = 0;
+      // Concurrent calls each need their own frame
+      for (int i = 0; i < 100; ++i) begin
+         fork
+            automatic int k = i;
+            add_many(k);
+         join_none
+      end
+      wait fork;
+      `checkd(sum, 64 * 4950);
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
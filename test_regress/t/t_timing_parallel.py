@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2026 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+
+test.compile(verilator_flags2=["--binary", "--timing", "--timing-parallel", "--threads", "2",
+                               "--stats"])
+
+# The agents' forever loops, and one of the 'shared' writers
+test.file_grep(test.stats, r'Timing, parallel processes\s+(\d+)', 17)
+test.file_grep(test.stats, r'Timing, parallel processes made serial\s+(\d+)', 1)
+
+test.execute()
+
+test.passes()
@@ -0,0 +1,65 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkd(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0d exp=%0d\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+
+`define STRINGIFY(x) `"x`"
+
+`timescale 1ns/1ns
+
+module agent #(parameter int ID = 0, parameter int PERIOD = 10);
+   int cnt = 0;
+   int acc = 0;
+   initial begin
+      forever begin
+         #PERIOD;
+         ++cnt;
+         acc += ID;
+      end
+   end
+   always #(PERIOD * 2) if (acc != cnt * ID) $stop;
+endmodule
+
+module t;
+   // Independent agents, resumed in parallel
+   for (genvar i = 0; i < 16; ++i) begin : gen_agent
+      agent #(.ID(i), .PERIOD(10 * (1 + i % 3))) u_agent ();
+   end
+
+   // Sharing a variable, so only the first is resumed in parallel
+   int shared = 0;
+   always #4 shared += 1;
+   always #4 shared += 2;
+
+   // Calling a task that suspends, so neither is resumed in parallel
+   int ticks = 0;
+   task automatic tick();
+      #3;
+      ++ticks;
+   endtask
+   initial forever tick();
+   initial forever tick();
+
+`ifdef TEST_TRACE
+   initial begin
+      $dumpfile(`STRINGIFY(`TEST_DUMPFILE));
+      $dumpvars;
+   end
+`endif
+
+   initial begin
+      #995;
+      `checkd(gen_agent[0].u_agent.cnt, 99);
+      `checkd(gen_agent[7].u_agent.cnt, 49);
+      `checkd(gen_agent[14].u_agent.cnt, 33);
+      `checkd(gen_agent[15].u_agent.acc, 99 * 15);
+      `checkd(shared, 248 * 3);
+      `checkd(ticks, 331 * 2);
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
@@ -45,7 +45,8 @@ for dfile in test.glob_some(test.obj_dir + "/*.d"):
 
 for filename in sorted(hit.keys()):
     if (not hit[filename] and not re.search(r'_sc', filename) and not re.search(r'_fst', filename)
-            and not re.search(r'_saif', filename) and not re.search(r'_thread', filename)
+            and not re.search(r'_saif', filename) and not re.search(r'_shm', filename)
+            and not re.search(r'_thread', filename)
             and (not re.search(r'_timing', filename) or test.have_coroutines)):
         test.error("Include file not covered by t_verilated_all test: ", filename)
 
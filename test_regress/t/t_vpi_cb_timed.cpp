@@ -0,0 +1,152 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// Copyright 2026 by Wilson Snyder. This program is free software; you can
+// redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include "verilated.h"
+#include "verilated_vpi.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef TEST_BENCHMARK
+#include <chrono>
+#endif
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+#include VM_PREFIX_INCLUDE
+
+//======================================================================
+
+int errors = 0;
+
+#ifdef TEST_BENCHMARK
+static constexpr int CALLBACKS = TEST_BENCHMARK;
+#else
+static constexpr int CALLBACKS = 1000;
+#endif
+
+static std::vector<int> s_called;  // Tags of callbacks called, in order
+static int s_count = 0;  // Callbacks called by the cycle loop
+
+static vpiHandle registerCb(PLI_INT32 reason, QData delay, PLI_INT32 (*cbp)(p_cb_data),
+                            int tag) {
+    s_vpi_time time;
+    time.type = vpiSimTime;
+    time.high = static_cast<PLI_UINT32>(delay >> 32);
+    time.low = static_cast<PLI_UINT32>(delay);
+    s_cb_data cbData;
+    cbData.reason = reason;
+    cbData.cb_rtn = cbp;
+    cbData.obj = nullptr;
+    cbData.time = &time;
+    cbData.value = nullptr;
+    cbData.user_data = reinterpret_cast<PLI_BYTE8*>(static_cast<intptr_t>(tag));
+    return vpi_register_cb(&cbData);
+}
+
+static PLI_INT32 recordCb(p_cb_data cbDatap) {
+    s_called.push_back(static_cast<int>(reinterpret_cast<intptr_t>(cbDatap->user_data)));
+    return 0;
+}
+
+static PLI_INT32 cycleCb(p_cb_data) {
+    // As cocotb does each cycle: a timer for the next cycle, and a timeout later removed
+    if (++s_count >= CALLBACKS) return 0;
+    vpi_release_handle(registerCb(cbAfterDelay, 1, cycleCb, 0));
+    vpi_remove_cb(registerCb(cbAfterDelay, 10, cycleCb, 0));
+    vpi_release_handle(registerCb(cbNextSimTime, 0, recordCb, 0));
+    return 0;
+}
+
+static void step(VerilatedContext* contextp, VM_PREFIX* topp) {
+    contextp->timeInc(1);
+    VerilatedVpi::callCbs(cbNextSimTime);
+    topp->clk = !topp->clk;
+    topp->eval();
+    VerilatedVpi::callTimedCbs();
+}
+
+static std::string takeCalled() {
+    // Tags of callbacks called since last taken, e.g. "2 4"
+    std::string called;
+    for (const int tag : s_called) called += (called.empty() ? "" : " ") + std::to_string(tag);
+    s_called.clear();
+    return called;
+}
+
+static void checkOrder(VerilatedContext* contextp, VM_PREFIX* topp) {
+    // Same time callbacks are called in registration order
+    const vpiHandle removedp = registerCb(cbAfterDelay, 3, recordCb, 1);
+    vpi_release_handle(registerCb(cbAfterDelay, 2, recordCb, 2));
+    vpi_release_handle(registerCb(cbAfterDelay, 3, recordCb, 3));
+    const vpiHandle firedp = registerCb(cbAfterDelay, 2, recordCb, 4);
+    vpi_release_handle(registerCb(cbNextSimTime, 0, recordCb, 5));
+    TEST_CHECK_EQ(VerilatedVpi::cbNextDeadline(), contextp->time() + 2);
+    vpi_remove_cb(removedp);
+
+    step(contextp, topp);
+    TEST_CHECK_EQ(takeCalled(), std::string{"5"});
+    step(contextp, topp);
+    TEST_CHECK_EQ(takeCalled(), std::string{"2 4"});
+    TEST_CHECK_EQ(VerilatedVpi::cbNextDeadline(), contextp->time() + 1);
+
+    // Removing a called callback must not remove the callback reusing its holder
+    const vpiHandle reusep = registerCb(cbAfterDelay, 1, recordCb, 6);
+    vpi_remove_cb(firedp);
+    step(contextp, topp);
+    TEST_CHECK_EQ(takeCalled(), std::string{"3 6"});
+    vpi_release_handle(reusep);
+    TEST_CHECK_EQ(VerilatedVpi::cbNextDeadline(), ~0ULL);
+}
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), ""}};
+    topp->clk = 0;
+    topp->eval();
+
+    checkOrder(contextp.get(), topp.get());
+
+    // One timed callback per cycle, each scheduling the next
+    vpi_release_handle(registerCb(cbAfterDelay, 1, cycleCb, 0));
+#ifdef TEST_BENCHMARK
+    const auto start = std::chrono::steady_clock::now();
+#endif
+    int steps = 0;
+    size_t nextSimTimes = 0;
+    while (s_count < CALLBACKS && steps <= CALLBACKS) {
+        step(contextp.get(), topp.get());
+        ++steps;
+        nextSimTimes += s_called.size();
+        s_called.clear();
+    }
+#ifdef TEST_BENCHMARK
+    const double elapsedNs
+        = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start)
+              .count();
+    printf("%d timed callbacks: %.1f ns/cycle\n", CALLBACKS, elapsedNs / CALLBACKS);
+#endif
+    TEST_CHECK_EQ(steps, CALLBACKS);
+    TEST_CHECK_EQ(s_count, CALLBACKS);
+    TEST_CHECK_EQ(nextSimTimes, static_cast<size_t>(CALLBACKS - 1));
+    // The removed timeouts are never called, and are freed when due
+    for (int i = 0; i < 10; ++i) step(contextp.get(), topp.get());
+    TEST_CHECK_EQ(s_count, CALLBACKS);
+    TEST_CHECK_EQ(takeCalled(), std::string{});
+    TEST_CHECK_EQ(VerilatedVpi::cbNextDeadline(), ~0ULL);
+
+    topp->final();
+    printf("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}
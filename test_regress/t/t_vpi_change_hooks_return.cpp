@@ -0,0 +1,92 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// Copyright 2026 by Wilson Snyder. This program is free software; you can
+// redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include "verilated.h"
+#include "verilated_vpi.h"
+
+#include VM_PREFIX_INCLUDE
+
+#include "vpi_user.h"
+
+#include <cstring>
+#include <memory>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+#include "TestSimulator.h"
+#include "TestVpi.h"
+
+int errors = 0;
+
+struct Watched final {
+    const char* m_namep;  // Signal name
+    TestVpiHandle m_handle;  // Signal handle
+    TestVpiHandle m_cb;  // Value change callback
+    PLI_INT32 m_seen = 0;  // Value when last called back
+    int m_calls = 0;  // Number of callbacks
+};
+
+static int valueCb(p_cb_data cb_data) {
+    Watched* const watchedp = reinterpret_cast<Watched*>(cb_data->user_data);
+    watchedp->m_seen = cb_data->value->value.integer;
+    ++watchedp->m_calls;
+    return 0;
+}
+
+static void watch(Watched& watched) {
+    watched.m_handle = VPI_HANDLE(watched.m_namep);
+    TEST_CHECK_NZ(watched.m_handle);
+    s_vpi_value v;
+    v.format = vpiIntVal;
+    t_cb_data cb_data;
+    bzero(&cb_data, sizeof(cb_data));
+    cb_data.cb_rtn = valueCb;
+    cb_data.reason = cbValueChange;
+    cb_data.obj = watched.m_handle;
+    cb_data.value = &v;
+    cb_data.user_data = reinterpret_cast<PLI_BYTE8*>(&watched);
+    watched.m_cb = vpi_register_cb(&cb_data);
+    TEST_CHECK_NZ(watched.m_cb);
+}
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), ""}};
+
+    Watched watched[] = {{"early"}, {"viac"}};
+    for (Watched& w : watched) watch(w);
+
+    topp->clk = 0;
+    topp->eval();
+    while (!contextp->gotFinish() && contextp->time() < 100) {
+        contextp->timeInc(1);
+        topp->clk = !topp->clk;
+        topp->eval();
+        VerilatedVpi::callValueCbs();
+        // Every change must have been called back
+        for (Watched& w : watched) {
+            s_vpi_value v;
+            v.format = vpiIntVal;
+            vpi_get_value(w.m_handle, &v);
+            TEST_CHECK_EQ(v.value.integer, w.m_seen);
+        }
+    }
+    TEST_CHECK_NZ(contextp->gotFinish());
+    for (Watched& w : watched) TEST_CHECK_NE(w.m_calls, 0);
+
+    topp->final();
+    for (Watched& w : watched) {
+        vpi_remove_cb(w.m_cb);
+        w.m_cb.freed();
+    }
+    return errors ? 10 : 0;
+}
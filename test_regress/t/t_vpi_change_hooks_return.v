@@ -0,0 +1,37 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk
+);
+
+   int cyc = 0;
+   int early /*verilator public_flat_rd*/;
+   int viac /*verilator public_flat_rd*/;
+
+   // Writes followed by an early return
+   function automatic int set_early(int value);
+      if (value[0]) begin
+         early = value;
+         return 1;
+      end
+      early = -value;
+      return 0;
+   endfunction
+
+   int odd = 0;
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      odd <= odd + set_early(cyc);
+      // Written by C code, not known to Verilator
+      $c(viac, " = ", cyc, " * 2;");
+      if (cyc == 20) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+
+endmodule
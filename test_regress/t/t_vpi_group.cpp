@@ -0,0 +1,191 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// Copyright 2026 by Wilson Snyder. This program is free software; you can
+// redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include "verilated.h"
+#include "verilated_vpi.h"
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+#include VM_PREFIX_INCLUDE
+
+//======================================================================
+
+int errors = 0;
+
+static constexpr int N = 10000;  // Signals per cycle, as in t_vpi_group.v
+#ifdef TEST_BENCHMARK
+static constexpr int CYCLES = TEST_BENCHMARK;
+#else
+static constexpr int CYCLES = 2;
+#endif
+
+static vpiHandle handle(const char* namep) {
+    return vpi_handle_by_name(const_cast<PLI_BYTE8*>(namep), nullptr);
+}
+
+// Add a variable by name, releasing its handle
+static bool add(VerilatedVpiGroup& group, const char* namep) {
+    const vpiHandle h = handle(namep);
+    const bool ok = group.add(h);
+    vpi_release_handle(h);
+    return ok;
+}
+
+static void tick(VM_PREFIX* topp) {
+    topp->clk = 1;
+    topp->eval();
+    topp->clk = 0;
+    topp->eval();
+}
+
+static bool changed(const std::vector<uint8_t>& changes, size_t index) {
+    return (changes[index >> 3] >> (index & 7)) & 1;
+}
+
+static void checkWidths(VM_PREFIX* topp) {
+    VerilatedVpiGroup group;
+    TEST_CHECK_EQ(add(group, "t.b1"), true);
+    TEST_CHECK_EQ(add(group, "t.s12"), true);
+    TEST_CHECK_EQ(add(group, "t.q40"), true);
+    TEST_CHECK_EQ(add(group, "t.w70"), true);
+    TEST_CHECK_EQ(add(group, "t.w70_inv"), true);
+    TEST_CHECK_EQ(group.size(), 5U);
+    TEST_CHECK_EQ(group.bytes(), 1U + 2U + 8U + 12U + 12U);
+    TEST_CHECK_EQ(group.offset(3), 11U);
+
+    // Whole unpacked arrays are rejected, their elements are accepted
+    TEST_CHECK_EQ(add(group, "t.mem"), false);
+    s_vpi_error_info info;
+    TEST_CHECK_NE(vpi_chk_error(&info), 0);
+    // Forceable variables are rejected, as their storage is not the forced value
+    TEST_CHECK_EQ(add(group, "t.forced"), false);
+    TEST_CHECK_NE(vpi_chk_error(&info), 0);
+    TEST_CHECK_EQ(group.size(), 5U);
+
+    // Values are masked to their widths
+    std::vector<uint8_t> buf(group.bytes(), 0xff);
+    group.put(buf.data());
+    TEST_CHECK_NE(vpi_chk_error(&info), 0);  // w70_inv is read-only
+    TEST_CHECK_EQ(VerilatedVpi::evalNeeded(), true);
+    VerilatedVpi::clearEvalNeeded();
+    tick(topp);
+
+    std::vector<uint8_t> changes(1);
+    group.get(buf.data(), changes.data());
+    TEST_CHECK_EQ(changes[0], 0x1f);  // First get reports all
+    CData b1;
+    SData s12;
+    QData q40;
+    EData w70[3];
+    EData w70Inv[3];
+    std::memcpy(&b1, &buf[group.offset(0)], sizeof(b1));
+    std::memcpy(&s12, &buf[group.offset(1)], sizeof(s12));
+    std::memcpy(&q40, &buf[group.offset(2)], sizeof(q40));
+    std::memcpy(w70, &buf[group.offset(3)], sizeof(w70));
+    std::memcpy(w70Inv, &buf[group.offset(4)], sizeof(w70Inv));
+    TEST_CHECK_EQ(b1, 1);
+    TEST_CHECK_EQ(s12, 0xfff);
+    TEST_CHECK_EQ(q40, 0xffffffffffULL);
+    TEST_CHECK_EQ(w70[0], 0xffffffffU);
+    TEST_CHECK_EQ(w70[2], 0x3fU);
+    TEST_CHECK_EQ(w70Inv[0], 0U);
+    TEST_CHECK_EQ(w70Inv[2], 0U);
+
+    // Only changed values are reported
+    group.get(buf.data(), changes.data());
+    TEST_CHECK_EQ(changes[0], 0);
+    s12 = 0x5a;
+    std::memcpy(&buf[group.offset(1)], &s12, sizeof(s12));
+    group.put(buf.data());
+    group.get(buf.data(), changes.data());
+    TEST_CHECK_EQ(changes[0], 0x2);
+}
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    Verilated::fatalOnVpiError(false);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), ""}};
+    topp->clk = 0;
+    topp->eval();
+
+    checkWidths(topp.get());
+
+    // Access N signals each cycle, as handles and as a group
+    std::vector<vpiHandle> memHandles(N);
+    std::vector<vpiHandle> outHandles(N);
+    VerilatedVpiGroup memGroup;
+    VerilatedVpiGroup outGroup;
+    const vpiHandle memp = handle("t.mem");
+    const vpiHandle outp = handle("t.out");
+    for (int i = 0; i < N; ++i) {
+        memHandles[i] = vpi_handle_by_index(memp, i);
+        outHandles[i] = vpi_handle_by_index(outp, i);
+        TEST_CHECK_EQ(memGroup.add(memHandles[i]), true);
+        TEST_CHECK_EQ(outGroup.add(outHandles[i]), true);
+    }
+    vpi_release_handle(memp);
+    vpi_release_handle(outp);
+    TEST_CHECK_EQ(memGroup.bytes(), N * sizeof(IData));
+
+    std::vector<IData> values(N);
+    for (int i = 0; i < N; ++i) values[i] = i;
+#ifdef TEST_BENCHMARK
+    const auto perSignalStart = std::chrono::steady_clock::now();
+#endif
+    for (int cyc = 0; cyc < CYCLES; ++cyc) {
+        s_vpi_value value;
+        value.format = vpiIntVal;
+        for (int i = 0; i < N; ++i) {
+            value.value.integer = values[i];
+            vpi_put_value(memHandles[i], &value, nullptr, vpiNoDelay);
+        }
+        tick(topp.get());
+        for (int i = 0; i < N; ++i) {
+            vpi_get_value(outHandles[i], &value);
+            values[i] = value.value.integer;
+        }
+    }
+#ifdef TEST_BENCHMARK
+    const auto groupStart = std::chrono::steady_clock::now();
+#endif
+    std::vector<uint8_t> changes((N + 7) / 8);
+    for (int cyc = 0; cyc < CYCLES; ++cyc) {
+        memGroup.put(values.data());
+        tick(topp.get());
+        outGroup.get(values.data(), changes.data());
+        TEST_CHECK_EQ(changed(changes, N - 1), true);
+    }
+#ifdef TEST_BENCHMARK
+    const auto groupEnd = std::chrono::steady_clock::now();
+    using Micro = std::chrono::duration<double, std::micro>;
+    const double perSignalUs = Micro(groupStart - perSignalStart).count();
+    const double groupUs = Micro(groupEnd - groupStart).count();
+    printf("%d signals: per-signal %.1f us/cycle, group %.1f us/cycle\n", N,
+           perSignalUs / CYCLES, groupUs / CYCLES);
+#endif
+    TEST_CHECK_EQ(values[0], 2U * CYCLES);
+    TEST_CHECK_EQ(values[N - 1], N - 1U + 2U * CYCLES);
+
+    for (int i = 0; i < N; ++i) {
+        vpi_release_handle(memHandles[i]);
+        vpi_release_handle(outHandles[i]);
+    }
+    topp->final();
+    printf("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,34 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+
+   input clk;
+
+   localparam N = 10000;
+
+   reg [31:0] mem[N] /*verilator public_flat_rw*/;
+   reg [31:0] out[N] /*verilator public_flat_rd*/;
+
+   reg        b1 /*verilator public_flat_rw*/;
+   reg [11:0] s12 /*verilator public_flat_rw*/;
+   reg [39:0] q40 /*verilator public_flat_rw*/;
+   reg [69:0] w70 /*verilator public_flat_rw*/;
+   reg [69:0] w70_inv /*verilator public_flat_rd*/;
+   reg [7:0]  forced /*verilator public_flat_rw*/ /*verilator forceable*/;
+
+   integer    i;
+
+   always @ (posedge clk) begin
+      for (i = 0; i < N; i = i + 1) out[i] <= mem[i] + 1;
+      w70_inv <= ~w70;
+      forced <= forced + 1;
+   end
+
+endmodule
@@ -0,0 +1,59 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// Copyright 2026 by Wilson Snyder. This program is free software; you can
+// redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include "verilated.h"
+#include "verilated_vpi.h"
+
+#include VM_PREFIX_INCLUDE
+
+#include "vpi_user.h"
+
+#include <memory>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+#include "TestSimulator.h"
+
+int errors = 0;
+
+int main(int argc, char** argv) {
+    // Each pass destroys its context and model, and the next will often be
+    // allocated at the same addresses, so lookups cached by
+    // vpi_handle_by_name must not refer to the destroyed model
+    for (int pass = 0; pass < 3; ++pass) {
+        const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+        contextp->commandArgs(argc, argv);
+        const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), ""}};
+        topp->eval();
+
+        for (int lookup = 0; lookup < 2; ++lookup) {
+            const PLI_INT32 value = pass * 10 + lookup + 1;
+            // Each lookup returns a handle owned by the caller
+            vpiHandle vh = VPI_HANDLE("count");
+            TEST_CHECK_NZ(vh);
+            s_vpi_value v;
+            v.format = vpiIntVal;
+            v.value.integer = value;
+            vpi_put_value(vh, &v, nullptr, vpiNoDelay);
+            topp->eval();
+            TEST_CHECK_EQ(topp->out, static_cast<uint32_t>(value));
+            v.value.integer = 0;
+            vpi_get_value(vh, &v);
+            TEST_CHECK_EQ(v.value.integer, value);
+            TEST_CHECK_EQ(vpi_release_handle(vh), 1);
+        }
+
+        topp->final();
+    }
+
+    printf("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}
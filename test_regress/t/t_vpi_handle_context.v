@@ -0,0 +1,15 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    output logic [31:0] out
+);
+
+   logic [31:0] count /*verilator public_flat_rw*/ = 0;
+
+   assign out = count;
+
+endmodule
@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2026 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+
+flags = ["--x-initial unique"]
+# With --benchmark 100000000, measure startup time of a large memory
+if test.benchmark:
+    flags += ["+define+BENCHMARK_N=" + str(test.benchmark)]
+
+test.compile(verilator_flags2=flags)
+
+test.execute(all_run_flags=["+verilator+rand+reset+2"])
+
+# Memories are reset with one call each, not a loop per element
+files = glob.glob(test.obj_dir + "/" + test.vm_prefix + "___024root__*__Slow.cpp")
+test.file_grep_any(files, r"VL_SCOPED_RAND_RESET_ARRAY_I\(")
+test.file_grep_any(files, r"VL_SCOPED_RAND_RESET_ARRAY_W\(")
+
+test.passes()
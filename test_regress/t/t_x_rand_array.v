@@ -0,0 +1,49 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2026 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkd(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0d exp=%0d\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+`define checkrange(gotv,minv,maxv) do if ((gotv) < (minv) || (gotv) > (maxv)) begin $write("%%Error: %s:%0d:  got=%0d exp=%0d-%0d\n", `__FILE__,`__LINE__, (gotv), (minv), (maxv)); `stop; end while(0);
+
+module t;
+   localparam int N =
+`ifdef BENCHMARK_N
+              `BENCHMARK_N;
+`else
+   1024;
+`endif
+
+   logic [31:0] mem[N];
+   logic [4:0] narrow[4][8];
+   logic [69:0] wide[16];
+   bit [7:0] zeroed[8];
+
+   int differ = 0;
+
+   initial begin
+      // Each element gets its own random value
+      for (int i = 1; i < N; ++i) if (mem[i] != mem[0]) ++differ;
+      `checkrange(differ, N / 2, N - 1);
+      differ = 0;
+      for (int i = 0; i < 4; ++i) begin
+         for (int j = 0; j < 8; ++j) begin
+            `checkrange(narrow[i][j], 0, 31);
+            if (narrow[i][j] != narrow[0][0]) ++differ;
+         end
+      end
+      `checkrange(differ, 1, 31);
+      differ = 0;
+      for (int i = 0; i < 16; ++i) begin
+         `checkrange(wide[i] >> 64, 0, 63);
+         if (wide[i] != wide[0]) ++differ;
+      end
+      `checkrange(differ, 1, 15);
+      // Two-state types are still zeroed
+      for (int i = 0; i < 8; ++i) `checkd(zeroed[i], 0);
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule